@@ -1,459 +1,355 @@
 #include "LUT.h"
 
-const float ADC_LUT[4096] = {
-    4.967602f,  4.891640f,  4.815678f,  4.817757f,  4.819835f,  4.821914f,  4.823992f,  4.826822f,  4.801351f,
-    4.775879f,  4.828945f,  4.782247f,  4.775879f,  4.781775f,  4.787672f,  4.793568f,  4.788084f,  4.781982f,
-    4.775879f,  4.775879f,  4.780125f,  4.784370f,  4.775879f,  4.775879f,  4.775879f,  4.775879f,  4.763144f,
-    4.769512f,  4.775879f,  4.762613f,  4.749347f,  4.775879f,  4.775879f,  4.749347f,  4.722814f,  4.774818f,
-    4.739795f,  4.733427f,  4.727059f,  4.724937f,  4.722814f,  4.722814f,  4.722814f,  4.730774f,  4.678239f,
-    4.693097f,  4.707956f,  4.722814f,  4.714058f,  4.718436f,  4.722814f,  4.696281f,  4.694513f,  4.692744f,
-    4.690975f,  4.710078f,  4.689914f,  4.669749f,  4.669749f,  4.669749f,  4.670810f,  4.671871f,  4.672933f,
-    4.669749f,  4.656482f,  4.669749f,  4.645339f,  4.653475f,  4.661612f,  4.669749f,  4.669749f,  4.644277f,
-    4.644041f,  4.643806f,  4.643570f,  4.630127f,  4.616683f,  4.623051f,  4.669749f,  4.646703f,  4.623658f,
-    4.616683f,  4.616683f,  4.616683f,  4.616683f,  4.616683f,  4.616683f,  4.602886f,  4.607485f,  4.612084f,
-    4.616683f,  4.616683f,  4.616683f,  4.603152f,  4.589620f,  4.578476f,  4.597580f,  4.616683f,  4.563618f,
-    4.563618f,  4.589089f,  4.563618f,  4.563618f,  4.608193f,  4.585905f,  4.563618f,  4.553005f,  4.558312f,
-    4.563618f,  4.563618f,  4.547345f,  4.544161f,  4.540977f,  4.536908f,  4.532840f,  4.540800f,  4.548760f,
-    4.534432f,  4.526472f,  4.518513f,  4.510553f,  4.519043f,  4.527534f,  4.510553f,  4.510553f,  4.510553f,
-    4.510553f,  4.505246f,  4.499940f,  4.510553f,  4.493572f,  4.494633f,  4.484551f,  4.474468f,  4.484020f,
-    4.482959f,  4.481897f,  4.480836f,  4.457487f,  4.476591f,  4.470223f,  4.463855f,  4.457487f,  4.508430f,
-    4.469516f,  4.463501f,  4.457487f,  4.457487f,  4.457487f,  4.457487f,  4.457487f,  4.457487f,  4.456780f,
-    4.456072f,  4.455365f,  4.457487f,  4.430955f,  4.404422f,  4.450058f,  4.427240f,  4.404422f,  4.419280f,
-    4.436261f,  4.412913f,  4.442629f,  4.430955f,  4.404422f,  4.404422f,  4.404422f,  4.404422f,  4.404422f,
-    4.402830f,  4.401238f,  4.404422f,  4.401710f,  4.398998f,  4.396285f,  4.360909f,  4.391686f,  4.390625f,
-    4.389564f,  4.392748f,  4.368338f,  4.351357f,  4.351357f,  4.351357f,  4.351357f,  4.351357f,  4.351357f,
-    4.351357f,  4.351357f,  4.351357f,  4.304659f,  4.351357f,  4.308904f,  4.385319f,  4.332253f,  4.351357f,
-    4.333315f,  4.333668f,  4.334022f,  4.334376f,  4.329423f,  4.325532f,  4.321640f,  4.317395f,  4.313150f,
-    4.306782f,  4.288527f,  4.281311f,  4.289801f,  4.298291f,  4.294754f,  4.291216f,  4.298291f,  4.279188f,
-    4.288740f,  4.298291f,  4.265391f,  4.296169f,  4.245226f,  4.245226f,  4.245226f,  4.257962f,  4.245226f,
-    4.245226f,  4.245226f,  4.209142f,  4.245226f,  4.234613f,  4.219755f,  4.247349f,  4.259554f,  4.271759f,
-    4.231783f,  4.245226f,  4.226653f,  4.208080f,  4.210274f,  4.212467f,  4.214660f,  4.192161f,  4.192161f,
-    4.228245f,  4.229306f,  4.230368f,  4.192161f,  4.192161f,  4.192161f,  4.192161f,  4.192161f,  4.192161f,
-    4.192161f,  4.208080f,  4.147586f,  4.192161f,  4.207019f,  4.184201f,  4.175313f,  4.166424f,  4.157536f,
-    4.148647f,  4.141218f,  4.170935f,  4.181017f,  4.191099f,  4.173765f,  4.156430f,  4.139095f,  4.139095f,
-    4.139095f,  4.139095f,  4.147161f,  4.124237f,  4.139095f,  4.139095f,  4.086030f,  4.112563f,  4.139095f,
-    4.122115f,  4.129013f,  4.135912f,  4.119992f,  4.121053f,  4.122115f,  4.123176f,  4.113624f,  4.086030f,
-    4.086030f,  4.086030f,  4.098766f,  4.094521f,  4.090275f,  4.086030f,  4.086030f,  4.064804f,  4.086030f,
-    4.086030f,  4.082846f,  4.079662f,  4.086030f,  4.077540f,  4.081785f,  4.086030f,  4.079662f,  4.048531f,
-    4.032965f,  4.059497f,  4.062681f,  4.032965f,  4.032965f,  4.032965f,  4.032965f,  4.032965f,  4.032965f,
-    4.032965f,  4.032965f,  4.032965f,  4.036502f,  4.034734f,  4.032965f,  4.032965f,  4.032965f,  3.988390f,
-    3.994404f,  4.000418f,  4.006432f,  3.989451f,  3.986267f,  3.983083f,  3.979899f,  3.994758f,  3.979899f,
-    4.015276f,  3.998649f,  3.982022f,  3.983083f,  3.979899f,  3.979899f,  3.979899f,  3.926834f,  3.979899f,
-    3.979899f,  3.979899f,  3.979899f,  3.966102f,  3.952305f,  3.975654f,  3.956551f,  3.937447f,  3.935325f,
-    3.926834f,  3.930018f,  3.926834f,  3.926834f,  3.926834f,  3.926834f,  3.926834f,  3.926834f,  3.926834f,
-    3.926834f,  3.926834f,  3.926834f,  3.907731f,  3.888627f,  3.911976f,  3.926834f,  3.926834f,  3.896269f,
-    3.873769f,  3.926834f,  3.873769f,  3.883851f,  3.893934f,  3.868816f,  3.866929f,  3.865043f,  3.863156f,
-    3.853604f,  3.873769f,  3.873769f,  3.873769f,  3.873769f,  3.858911f,  3.847236f,  3.833439f,  3.820703f,
-    3.827071f,  3.826010f,  3.824949f,  3.836092f,  3.847236f,  3.833970f,  3.820703f,  3.820703f,  3.820703f,
-    3.820703f,  3.820703f,  3.820703f,  3.820703f,  3.822402f,  3.820703f,  3.778251f,  3.820703f,  3.820703f,
-    3.802661f,  3.812213f,  3.767638f,  3.771353f,  3.775067f,  3.774006f,  3.772355f,  3.770704f,  3.769053f,
-    3.784619f,  3.776129f,  3.767638f,  3.780374f,  3.767638f,  3.767638f,  3.757556f,  3.747473f,  3.767638f,
-    3.767638f,  3.767638f,  3.767638f,  3.767638f,  3.729431f,  3.767638f,  3.749596f,  3.761270f,  3.749596f,
-    3.737922f,  3.718818f,  3.714573f,  3.714573f,  3.714573f,  3.714573f,  3.741105f,  3.714573f,  3.722002f,
-    3.705552f,  3.689101f,  3.689101f,  3.701837f,  3.714573f,  3.714573f,  3.712450f,  3.710328f,  3.688040f,
-    3.696884f,  3.679196f,  3.661507f,  3.661507f,  3.661507f,  3.671059f,  3.666283f,  3.661507f,  3.661507f,
-    3.661507f,  3.661507f,  3.661507f,  3.661507f,  3.661507f,  3.655989f,  3.632852f,  3.661507f,  3.627546f,
-    3.638159f,  3.623300f,  3.608442f,  3.608442f,  3.608442f,  3.608442f,  3.608442f,  3.635329f,  3.621885f,
-    3.608442f,  3.608442f,  3.608442f,  3.608442f,  3.608442f,  3.608442f,  3.604904f,  3.600305f,  3.595706f,
-    3.582440f,  3.569174f,  3.573419f,  3.577664f,  3.581910f,  3.555377f,  3.578726f,  3.602074f,  3.563867f,
-    3.608442f,  3.548160f,  3.572358f,  3.555377f,  3.586155f,  3.570766f,  3.555377f,  3.555377f,  3.528844f,
-    3.502312f,  3.535212f,  3.529905f,  3.523184f,  3.516462f,  3.509741f,  3.542641f,  3.506557f,  3.508414f,
-    3.510271f,  3.512129f,  3.513986f,  3.515843f,  3.517700f,  3.519558f,  3.521415f,  3.523272f,  3.525130f,
-    3.526987f,  3.528844f,  3.502312f,  3.502312f,  3.502312f,  3.502312f,  3.498420f,  3.500366f,  3.502312f,
-    3.502312f,  3.475779f,  3.502312f,  3.496474f,  3.490637f,  3.484800f,  3.478963f,  3.463043f,  3.465873f,
-    3.468703f,  3.471534f,  3.502312f,  3.484623f,  3.466935f,  3.449246f,  3.449246f,  3.449246f,  3.449246f,
-    3.449246f,  3.449246f,  3.442878f,  3.436511f,  3.430143f,  3.449246f,  3.446062f,  3.442878f,  3.449246f,
-    3.422714f,  3.396181f,  3.413162f,  3.418468f,  3.411570f,  3.404671f,  3.401841f,  3.399011f,  3.396181f,
-    3.390521f,  3.384860f,  3.379200f,  3.387160f,  3.395120f,  3.396181f,  3.396181f,  3.343116f,  3.343116f,
-    3.365191f,  3.383445f,  3.396181f,  3.371771f,  3.343116f,  3.356382f,  3.369648f,  3.343116f,  3.343116f,
-    3.343116f,  3.343116f,  3.343116f,  3.343116f,  3.343116f,  3.343116f,  3.319767f,  3.343116f,  3.316583f,
-    3.290050f,  3.343116f,  3.322951f,  3.302786f,  3.338870f,  3.327196f,  3.314814f,  3.302432f,  3.290050f,
-    3.290050f,  3.290050f,  3.316583f,  3.290050f,  3.290050f,  3.290050f,  3.290050f,  3.294030f,  3.298010f,
-    3.295357f,  3.292703f,  3.290050f,  3.290050f,  3.290050f,  3.290050f,  3.236985f,  3.290050f,  3.264579f,
-    3.288989f,  3.257150f,  3.250706f,  3.244262f,  3.236985f,  3.236985f,  3.236985f,  3.236985f,  3.236985f,
-    3.236985f,  3.236985f,  3.224249f,  3.211514f,  3.236985f,  3.228494f,  3.236985f,  3.222127f,  3.213636f,
-    3.205146f,  3.196655f,  3.204084f,  3.183920f,  3.236985f,  3.183920f,  3.183920f,  3.183920f,  3.183920f,
-    3.183920f,  3.183920f,  3.183920f,  3.166939f,  3.175429f,  3.183920f,  3.183920f,  3.177552f,  3.166939f,
-    3.183920f,  3.130854f,  3.136161f,  3.154203f,  3.130854f,  3.152788f,  3.174722f,  3.152788f,  3.130854f,
-    3.130854f,  3.132977f,  3.154203f,  3.130854f,  3.124133f,  3.117411f,  3.115642f,  3.113873f,  3.106444f,
-    3.124486f,  3.130854f,  3.130324f,  3.129793f,  3.112458f,  3.095124f,  3.077789f,  3.104322f,  3.109628f,
-    3.103260f,  3.094770f,  3.086279f,  3.077789f,  3.094239f,  3.077789f,  3.064523f,  3.051256f,  3.077789f,
-    3.077789f,  3.077789f,  3.077789f,  3.064523f,  3.051256f,  3.026846f,  3.052318f,  3.077789f,  3.062400f,
-    3.047011f,  3.043827f,  3.050902f,  3.075666f,  3.050195f,  3.024724f,  3.037459f,  3.077789f,  3.024724f,
-    3.024724f,  3.036929f,  3.049134f,  3.024724f,  3.024724f,  3.024724f,  3.024724f,  3.024724f,  3.024724f,
-    3.003497f,  2.983333f,  2.986517f,  2.981564f,  2.976611f,  2.971658f,  2.986517f,  2.991823f,  2.991823f,
-    2.991823f,  2.991823f,  2.971658f,  2.956800f,  2.971658f,  2.969536f,  2.967413f,  2.965290f,  2.971658f,
-    2.947248f,  2.971658f,  2.971658f,  2.971658f,  2.971658f,  2.939819f,  2.955739f,  2.971658f,  2.943357f,
-    2.936753f,  2.930149f,  2.923546f,  2.918593f,  2.918593f,  2.918593f,  2.918593f,  2.918593f,  2.918593f,
-    2.907449f,  2.896305f,  2.905327f,  2.914348f,  2.912756f,  2.911164f,  2.888169f,  2.894890f,  2.901612f,
-    2.902143f,  2.902673f,  2.910102f,  2.865528f,  2.865528f,  2.865528f,  2.837934f,  2.844832f,  2.851731f,
-    2.879855f,  2.907980f,  2.886754f,  2.865528f,  2.865528f,  2.864466f,  2.863405f,  2.865528f,  2.857037f,
-    2.848547f,  2.836519f,  2.848547f,  2.822368f,  2.817415f,  2.812462f,  2.823075f,  2.812462f,  2.812462f,
-    2.799727f,  2.786991f,  2.812462f,  2.812462f,  2.812462f,  2.812462f,  2.799727f,  2.786991f,  2.812462f,
-    2.812462f,  2.812462f,  2.812462f,  2.793359f,  2.776378f,  2.786460f,  2.796543f,  2.801319f,  2.806094f,
-    2.759397f,  2.759397f,  2.765057f,  2.770718f,  2.776378f,  2.759397f,  2.766371f,  2.759397f,  2.759397f,
-    2.744539f,  2.729680f,  2.742416f,  2.759397f,  2.756478f,  2.753560f,  2.750641f,  2.747723f,  2.759397f,
-    2.723313f,  2.728088f,  2.732864f,  2.727558f,  2.706332f,  2.732864f,  2.724197f,  2.715530f,  2.706332f,
-    2.706332f,  2.706332f,  2.699964f,  2.707039f,  2.714115f,  2.721190f,  2.706332f,  2.706332f,  2.706332f,
-    2.680330f,  2.654328f,  2.676969f,  2.656450f,  2.685106f,  2.672370f,  2.659634f,  2.675554f,  2.653266f,
-    2.610814f,  2.624965f,  2.639116f,  2.653266f,  2.640531f,  2.653266f,  2.653266f,  2.653266f,  2.644776f,
-    2.649021f,  2.653266f,  2.644776f,  2.602324f,  2.624611f,  2.604446f,  2.606569f,  2.626734f,  2.613467f,
-    2.600201f,  2.603385f,  2.606569f,  2.618243f,  2.610814f,  2.600201f,  2.600201f,  2.600201f,  2.595248f,
-    2.597725f,  2.600201f,  2.600201f,  2.600201f,  2.600201f,  2.585343f,  2.570484f,  2.555626f,  2.576852f,
-    2.589588f,  2.577914f,  2.566239f,  2.600201f,  2.580390f,  2.547136f,  2.568362f,  2.542890f,  2.508929f,
-    2.528032f,  2.547136f,  2.570484f,  2.540768f,  2.543952f,  2.547136f,  2.506806f,  2.519542f,  2.528563f,
-    2.537584f,  2.546605f,  2.539353f,  2.515296f,  2.513174f,  2.547136f,  2.547136f,  2.494070f,  2.494070f,
-    2.494070f,  2.494070f,  2.494070f,  2.494070f,  2.494070f,  2.494070f,  2.494070f,  2.494070f,  2.494070f,
-    2.481335f,  2.468599f,  2.483457f,  2.474967f,  2.494070f,  2.491948f,  2.492478f,  2.493009f,  2.493540f,
-    2.494070f,  2.456925f,  2.451618f,  2.460816f,  2.470014f,  2.462939f,  2.455863f,  2.449495f,  2.435168f,
-    2.441005f,  2.441005f,  2.441005f,  2.441005f,  2.441005f,  2.441005f,  2.441005f,  2.387940f,  2.391194f,
-    2.394449f,  2.397704f,  2.400958f,  2.404213f,  2.387940f,  2.389001f,  2.387940f,  2.403859f,  2.395899f,
-    2.387940f,  2.343365f,  2.387940f,  2.387940f,  2.387940f,  2.387940f,  2.387940f,  2.387940f,  2.387940f,
-    2.387940f,  2.368836f,  2.364591f,  2.366926f,  2.369261f,  2.351855f,  2.364591f,  2.353978f,  2.334874f,
-    2.334874f,  2.334874f,  2.334874f,  2.334874f,  2.334874f,  2.334874f,  2.334874f,  2.334874f,  2.334874f,
-    2.334874f,  2.334874f,  2.322139f,  2.334874f,  2.334874f,  2.326030f,  2.317186f,  2.308342f,  2.327445f,
-    2.281809f,  2.307280f,  2.332752f,  2.313648f,  2.334874f,  2.334874f,  2.281809f,  2.281809f,  2.282340f,
-    2.282870f,  2.281809f,  2.281809f,  2.281809f,  2.281809f,  2.281809f,  2.281809f,  2.274380f,  2.278094f,
-    2.281809f,  2.261114f,  2.240418f,  2.240949f,  2.241479f,  2.281809f,  2.243248f,  2.241286f,  2.239325f,
-    2.237363f,  2.235401f,  2.233439f,  2.231477f,  2.229516f,  2.227554f,  2.225592f,  2.223630f,  2.221668f,
-    2.228744f,  2.228744f,  2.228744f,  2.228744f,  2.228744f,  2.224498f,  2.254215f,  2.228213f,  2.202211f,
-    2.215477f,  2.228744f,  2.209640f,  2.190537f,  2.187942f,  2.185348f,  2.182754f,  2.190537f,  2.191598f,
-    2.192659f,  2.184169f,  2.175678f,  2.212824f,  2.194251f,  2.175678f,  2.145962f,  2.175678f,  2.175678f,
-    2.175678f,  2.168249f,  2.175678f,  2.173556f,  2.168249f,  2.162943f,  2.149146f,  2.154983f,  2.160820f,
-    2.122613f,  2.137471f,  2.130042f,  2.122613f,  2.122613f,  2.122613f,  2.122613f,  2.122613f,  2.122613f,
-    2.122613f,  2.122613f,  2.115538f,  2.108462f,  2.101387f,  2.114123f,  2.120490f,  2.113486f,  2.106481f,
-    2.082283f,  2.083345f,  2.084406f,  2.082283f,  2.080161f,  2.078038f,  2.074854f,  2.072201f,  2.069548f,
-    2.069548f,  2.069548f,  2.069548f,  2.069548f,  2.069548f,  2.069548f,  2.047048f,  2.051506f,  2.029218f,
-    2.018605f,  2.044076f,  2.069548f,  2.057873f,  2.029926f,  2.028275f,  2.026624f,  2.024973f,  2.030279f,
-    2.035586f,  2.040892f,  2.016482f,  2.016482f,  2.016482f,  2.016482f,  2.016482f,  2.016482f,  1.993134f,
-    1.987827f,  1.982521f,  2.012237f,  2.014360f,  2.016482f,  1.998794f,  2.016482f,  1.988888f,  1.998971f,
-    2.009053f,  1.982521f,  1.963417f,  1.963417f,  1.965540f,  1.963417f,  1.971908f,  1.980398f,  1.963417f,
-    1.963417f,  1.959526f,  1.955634f,  1.951743f,  1.963417f,  1.944314f,  1.953865f,  1.963417f,  1.958747f,
-    1.954078f,  1.950681f,  1.929455f,  1.944314f,  1.927333f,  1.910352f,  1.910352f,  1.910352f,  1.910352f,
-    1.910352f,  1.910352f,  1.910352f,  1.954927f,  1.863654f,  1.910352f,  1.894963f,  1.879574f,  1.905045f,
-    1.903453f,  1.901861f,  1.899208f,  1.896555f,  1.884880f,  1.895493f,  1.857286f,  1.857286f,  1.857286f,
-    1.877451f,  1.883288f,  1.889126f,  1.865777f,  1.867899f,  1.838183f,  1.857286f,  1.857286f,  1.857286f,
-    1.850919f,  1.857286f,  1.834999f,  1.812712f,  1.821733f,  1.830754f,  1.821202f,  1.811650f,  1.838183f,
-    1.855164f,  1.848796f,  1.842428f,  1.814834f,  1.791485f,  1.804221f,  1.772382f,  1.798915f,  1.801568f,
-    1.804221f,  1.805636f,  1.772382f,  1.784056f,  1.795731f,  1.804221f,  1.795377f,  1.786533f,  1.782111f,
-    1.777688f,  1.804221f,  1.780872f,  1.768137f,  1.751156f,  1.751156f,  1.751156f,  1.751156f,  1.751156f,
-    1.751156f,  1.751156f,  1.763184f,  1.775212f,  1.787240f,  1.751156f,  1.751156f,  1.774505f,  1.743196f,
-    1.742665f,  1.744788f,  1.732052f,  1.698090f,  1.740543f,  1.720024f,  1.721675f,  1.723326f,  1.724977f,
-    1.711534f,  1.698090f,  1.736297f,  1.717194f,  1.698090f,  1.708703f,  1.703397f,  1.698090f,  1.698090f,
-    1.698090f,  1.678987f,  1.698090f,  1.671558f,  1.672619f,  1.674742f,  1.676864f,  1.689600f,  1.682171f,
-    1.674742f,  1.676157f,  1.667619f,  1.659082f,  1.650544f,  1.645025f,  1.645025f,  1.645025f,  1.659883f,
-    1.604695f,  1.632289f,  1.602573f,  1.621676f,  1.640780f,  1.645025f,  1.645025f,  1.639719f,  1.634412f,
-    1.629106f,  1.617431f,  1.615309f,  1.595497f,  1.600096f,  1.604695f,  1.598328f,  1.591960f,  1.591960f,
-    1.591960f,  1.591960f,  1.591960f,  1.591960f,  1.591960f,  1.591960f,  1.591960f,  1.591960f,  1.591960f,
-    1.571583f,  1.591960f,  1.571441f,  1.578281f,  1.585120f,  1.591960f,  1.538894f,  1.581347f,  1.571205f,
-    1.561064f,  1.550923f,  1.547385f,  1.543140f,  1.538894f,  1.538894f,  1.538894f,  1.538894f,  1.538894f,
-    1.528281f,  1.538894f,  1.538894f,  1.538894f,  1.494320f,  1.538894f,  1.538894f,  1.538894f,  1.538894f,
-    1.512362f,  1.508117f,  1.503871f,  1.499626f,  1.493789f,  1.487952f,  1.485829f,  1.485829f,  1.485829f,
-    1.485829f,  1.485829f,  1.485829f,  1.485829f,  1.477339f,  1.468848f,  1.460358f,  1.485829f,  1.477339f,
-    1.468848f,  1.461419f,  1.453990f,  1.448683f,  1.432764f,  1.432764f,  1.432764f,  1.432764f,  1.432764f,
-    1.432764f,  1.432764f,  1.432764f,  1.432764f,  1.432764f,  1.420028f,  1.432764f,  1.427103f,  1.421443f,
-    1.415783f,  1.420559f,  1.403047f,  1.412599f,  1.422151f,  1.386066f,  1.418967f,  1.399333f,  1.379698f,
-    1.379698f,  1.379698f,  1.379698f,  1.379698f,  1.379698f,  1.379698f,  1.379698f,  1.379698f,  1.353166f,
-    1.379698f,  1.379698f,  1.379698f,  1.353166f,  1.348921f,  1.375453f,  1.367317f,  1.359180f,  1.351043f,
-    1.342907f,  1.326633f,  1.326633f,  1.330348f,  1.334062f,  1.326633f,  1.328048f,  1.322919f,  1.326633f,
-    1.313367f,  1.300100f,  1.326633f,  1.273568f,  1.326633f,  1.325572f,  1.324511f,  1.326633f,  1.326633f,
-    1.326633f,  1.273568f,  1.288426f,  1.273568f,  1.273568f,  1.273568f,  1.273568f,  1.273568f,  1.273568f,
-    1.273568f,  1.273568f,  1.273568f,  1.273568f,  1.273568f,  1.273568f,  1.273568f,  1.233238f,  1.273568f,
-    1.270384f,  1.267200f,  1.261893f,  1.220503f,  1.220503f,  1.220503f,  1.231116f,  1.241729f,  1.223686f,
-    1.220503f,  1.235361f,  1.250219f,  1.235361f,  1.220503f,  1.269323f,  1.220503f,  1.220503f,  1.220503f,
-    1.190786f,  1.220503f,  1.220503f,  1.220503f,  1.193970f,  1.167437f,  1.193970f,  1.203522f,  1.218380f,
-    1.167437f,  1.209889f,  1.201399f,  1.176989f,  1.195562f,  1.214135f,  1.191241f,  1.168347f,  1.167437f,
-    1.167437f,  1.158593f,  1.149749f,  1.140905f,  1.155763f,  1.153286f,  1.150810f,  1.148334f,  1.114372f,
-    1.167437f,  1.149395f,  1.131353f,  1.154701f,  1.119678f,  1.114372f,  1.114372f,  1.114372f,  1.121447f,
-    1.119089f,  1.116730f,  1.114372f,  1.109065f,  1.114372f,  1.114372f,  1.114372f,  1.114372f,  1.108004f,
-    1.101636f,  1.087839f,  1.114372f,  1.085717f,  1.073512f,  1.061307f,  1.072627f,  1.069089f,  1.065552f,
-    1.071389f,  1.077226f,  1.069266f,  1.061307f,  1.061307f,  1.061307f,  1.061307f,  1.061307f,  1.058653f,
-    1.059184f,  1.057061f,  1.054939f,  1.042203f,  1.030882f,  1.019562f,  1.008241f,  1.020977f,  1.020977f,
-    1.020977f,  1.020977f,  1.008241f,  1.016024f,  1.023807f,  1.031590f,  1.039373f,  1.008241f,  1.008241f,
-    1.003288f,  0.998336f,  0.993383f,  0.984539f,  0.975694f,  0.991968f,  1.008241f,  1.004350f,  1.000458f,
-    0.996567f,  0.972687f,  0.964993f,  0.957298f,  0.955902f,  0.954506f,  0.953647f,  0.952789f,  0.951930f,
-    0.951072f,  0.950213f,  0.949355f,  0.948496f,  0.947638f,  0.946779f,  0.945921f,  0.945063f,  0.944204f,
-    0.943346f,  0.942487f,  0.941629f,  0.940770f,  0.939912f,  0.939053f,  0.938195f,  0.902111f,  0.933950f,
-    0.944563f,  0.955176f,  0.898573f,  0.908832f,  0.919091f,  0.876639f,  0.889375f,  0.902111f,  0.902111f,
-    0.902111f,  0.902111f,  0.902111f,  0.902111f,  0.902111f,  0.902111f,  0.902111f,  0.888844f,  0.875578f,
-    0.888844f,  0.902111f,  0.874517f,  0.872394f,  0.879823f,  0.887252f,  0.881415f,  0.875578f,  0.858243f,
-    0.842677f,  0.845861f,  0.849045f,  0.849045f,  0.849045f,  0.849045f,  0.849045f,  0.849045f,  0.845861f,
-    0.842677f,  0.839493f,  0.849045f,  0.849045f,  0.801286f,  0.806062f,  0.810838f,  0.814376f,  0.795980f,
-    0.812961f,  0.807300f,  0.801640f,  0.795980f,  0.768386f,  0.767678f,  0.766971f,  0.766263f,  0.810838f,
-    0.784306f,  0.795980f,  0.795980f,  0.769447f,  0.742915f,  0.782714f,  0.743976f,  0.764141f,  0.753528f,
-    0.742915f,  0.742915f,  0.742915f,  0.742915f,  0.742915f,  0.742915f,  0.742915f,  0.742915f,  0.742915f,
-    0.742915f,  0.742915f,  0.719566f,  0.721688f,  0.718858f,  0.716028f,  0.742915f,  0.741853f,  0.740792f,
-    0.689849f,  0.707538f,  0.725226f,  0.742915f,  0.691972f,  0.689849f,  0.689849f,  0.728056f,  0.716382f,
-    0.715321f,  0.685604f,  0.689849f,  0.689849f,  0.689849f,  0.688434f,  0.687019f,  0.685604f,  0.684189f,
-    0.687019f,  0.689849f,  0.638199f,  0.655416f,  0.672632f,  0.689849f,  0.689849f,  0.658010f,  0.637491f,
-    0.636784f,  0.636784f,  0.636784f,  0.636784f,  0.636784f,  0.636784f,  0.636784f,  0.636784f,  0.636784f,
-    0.626878f,  0.631831f,  0.636784f,  0.627232f,  0.617680f,  0.586903f,  0.592917f,  0.599638f,  0.583719f,
-    0.583719f,  0.636784f,  0.583719f,  0.590086f,  0.587964f,  0.585841f,  0.583719f,  0.583719f,  0.583719f,
-    0.583719f,  0.583719f,  0.583719f,  0.583719f,  0.583719f,  0.539144f,  0.561431f,  0.583719f,  0.557186f,
-    0.551879f,  0.554002f,  0.549757f,  0.545158f,  0.540559f,  0.535960f,  0.530653f,  0.530653f,  0.530653f,
-    0.549757f,  0.568860f,  0.530653f,  0.530653f,  0.530653f,  0.505182f,  0.517918f,  0.530653f,  0.522870f,
-    0.504121f,  0.499345f,  0.494569f,  0.489262f,  0.483956f,  0.481833f,  0.479711f,  0.477588f,  0.477588f,
-    0.477588f,  0.485017f,  0.492446f,  0.477588f,  0.477588f,  0.477588f,  0.477588f,  0.477588f,  0.477588f,
-    0.477588f,  0.471751f,  0.465914f,  0.456362f,  0.447871f,  0.439381f,  0.441655f,  0.443929f,  0.434226f,
-    0.424523f,  0.424523f,  0.424523f,  0.424523f,  0.424523f,  0.424523f,  0.426822f,  0.429122f,  0.431421f,
-    0.433721f,  0.464852f,  0.424523f,  0.424523f,  0.444687f,  0.424523f,  0.401174f,  0.402235f,  0.388438f,
-    0.397459f,  0.406480f,  0.415502f,  0.424523f,  0.414263f,  0.404004f,  0.387731f,  0.371457f,  0.371457f,
-    0.384900f,  0.371457f,  0.371590f,  0.371723f,  0.345986f,  0.334312f,  0.322637f,  0.338203f,  0.353769f,
-    0.353415f,  0.353061f,  0.352708f,  0.352354f,  0.335373f,  0.318392f,  0.321576f,  0.324760f,  0.327236f,
-    0.329713f,  0.320515f,  0.319453f,  0.318392f,  0.318392f,  0.318392f,  0.318392f,  0.318392f,  0.315739f,
-    0.313085f,  0.310432f,  0.307779f,  0.306718f,  0.305656f,  0.304595f,  0.265327f,  0.275940f,  0.291329f,
-    0.265327f,  0.265327f,  0.265327f,  0.265327f,  0.265327f,  0.265327f,  0.265327f,  0.265327f,  0.265327f,
-    0.265327f,  0.247638f,  0.229950f,  0.212261f,  0.242685f,  0.252945f,  0.263204f,  0.238794f,  0.220752f,
-    0.212261f,  0.214384f,  0.216507f,  0.218629f,  0.212261f,  0.223936f,  0.235610f,  0.212261f,  0.212261f,
-    0.212261f,  0.212261f,  0.212261f,  0.212261f,  0.198995f,  0.189974f,  0.186790f,  0.212261f,  0.212261f,
-    0.159196f,  0.174054f,  0.208016f,  0.212261f,  0.194219f,  0.176177f,  0.200941f,  0.188087f,  0.175233f,
-    0.162380f,  0.180422f,  0.154420f,  0.159196f,  0.159196f,  0.159196f,  0.159196f,  0.159196f,  0.159196f,
-    0.159196f,  0.120989f,  0.159196f,  0.132663f,  0.119397f,  0.106131f,  0.132663f,  0.148583f,  0.132663f,
-    0.130328f,  0.119291f,  0.108253f,  0.106131f,  0.106131f,  0.106131f,  0.106131f,  0.106131f,  0.130541f,
-    0.154951f,  0.109845f,  0.064740f,  0.058903f,  0.053065f,  0.098702f,  0.089150f,  0.065801f,  0.064740f,
-    0.063678f,  0.106131f,  0.057311f,  0.053065f,  0.075707f,  0.070046f,  0.063148f,  0.056249f,  0.101885f,
-    0.085612f,  0.069339f,  0.053065f,  0.019104f,  0.053065f,  0.026533f,  0.022641f,  0.053065f,  0.053065f,
-    0.046697f,  0.040330f,  0.016981f,  0.023083f,  0.029186f,  0.035288f,  0.041391f,  0.014858f,  0.000000f,
-    0.001061f,  0.002123f,  0.000000f,  0.000000f,  -0.007429f, -0.014858f, 0.000000f,  0.000000f,  0.000000f,
-    -0.006085f, -0.012170f, -0.018254f, -0.024339f, -0.030424f, 0.000000f,  0.000000f,  -0.027594f, -0.027594f,
-    -0.053065f, -0.053065f, -0.053065f, -0.045106f, -0.037146f, -0.045106f, -0.053065f, -0.053065f, -0.053065f,
-    -0.053065f, -0.050707f, -0.048348f, -0.045990f, -0.049528f, -0.053065f, -0.053065f, -0.106131f, -0.053065f,
-    -0.106131f, -0.053773f, -0.079952f, -0.106131f, -0.093395f, -0.106131f, -0.083843f, -0.091272f, -0.098702f,
-    -0.106131f, -0.106131f, -0.106131f, -0.057311f, -0.106131f, -0.106131f, -0.133725f, -0.113914f, -0.115329f,
-    -0.116744f, -0.137970f, -0.159196f, -0.150706f, -0.125234f, -0.118866f, -0.112498f, -0.106131f, -0.106131f,
-    -0.130010f, -0.153889f, -0.124173f, -0.159196f, -0.159196f, -0.150706f, -0.142215f, -0.134786f, -0.159196f,
-    -0.183606f, -0.159196f, -0.196342f, -0.188913f, -0.181483f, -0.174054f, -0.185729f, -0.186259f, -0.186790f,
-    -0.192096f, -0.171932f, -0.207167f, -0.212261f, -0.206247f, -0.200233f, -0.194219f, -0.212261f, -0.220752f,
-    -0.229242f, -0.212261f, -0.214384f, -0.216507f, -0.249407f, -0.212261f, -0.229950f, -0.265327f, -0.212261f,
-    -0.221106f, -0.229950f, -0.238794f, -0.236141f, -0.233487f, -0.265327f, -0.265327f, -0.265327f, -0.265327f,
-    -0.265327f, -0.265327f, -0.265327f, -0.269041f, -0.272756f, -0.273817f, -0.274878f, -0.280185f, -0.318392f,
-    -0.291859f, -0.265327f, -0.287083f, -0.308840f, -0.313085f, -0.304241f, -0.308958f, -0.313675f, -0.318392f,
-    -0.265327f, -0.318392f, -0.318392f, -0.304241f, -0.318392f, -0.318392f, -0.318392f, -0.318392f, -0.318392f,
-    -0.318392f, -0.318392f, -0.318392f, -0.333958f, -0.334429f, -0.334901f, -0.335373f, -0.337260f, -0.339146f,
-    -0.341033f, -0.318392f, -0.362967f, -0.340467f, -0.371457f, -0.371457f, -0.358722f, -0.371457f, -0.371457f,
-    -0.371457f, -0.359783f, -0.365620f, -0.371457f, -0.371457f, -0.350231f, -0.360844f, -0.371457f, -0.373580f,
-    -0.373580f, -0.377118f, -0.380655f, -0.384193f, -0.371457f, -0.386316f, -0.401174f, -0.402766f, -0.410018f,
-    -0.417270f, -0.424523f, -0.403296f, -0.382070f, -0.424523f, -0.424523f, -0.424523f, -0.424523f, -0.425372f,
-    -0.444334f, -0.452647f, -0.460961f, -0.469274f, -0.477588f, -0.450702f, -0.441504f, -0.436728f, -0.431952f,
-    -0.447341f, -0.462730f, -0.473343f, -0.471220f, -0.469097f, -0.477588f, -0.477588f, -0.477588f, -0.477588f,
-    -0.513672f, -0.477588f, -0.477588f, -0.477588f, -0.477588f, -0.477588f, -0.477588f, -0.481833f, -0.483956f,
-    -0.530653f, -0.514734f, -0.518979f, -0.523224f, -0.516219f, -0.530653f, -0.530653f, -0.543920f, -0.540603f,
-    -0.537286f, -0.533970f, -0.530653f, -0.530653f, -0.530653f, -0.530653f, -0.530653f, -0.547634f, -0.564615f,
-    -0.530653f, -0.552233f, -0.573813f, -0.557186f, -0.577351f, -0.583719f, -0.582834f, -0.581950f, -0.581065f,
-    -0.580181f, -0.581950f, -0.583719f, -0.558247f, -0.570983f, -0.583719f, -0.583719f, -0.604945f, -0.583719f,
-    -0.583719f, -0.590086f, -0.596454f, -0.602822f, -0.617680f, -0.590086f, -0.583719f, -0.636784f, -0.621926f,
-    -0.607067f, -0.603530f, -0.599992f, -0.636784f, -0.636784f, -0.636784f, -0.636784f, -0.659425f, -0.666147f,
-    -0.672868f, -0.648458f, -0.647397f, -0.646336f, -0.645274f, -0.678175f, -0.657479f, -0.636784f, -0.636784f,
-    -0.670746f, -0.636784f, -0.686665f, -0.683077f, -0.679489f, -0.675901f, -0.682875f, -0.689849f, -0.689319f,
-    -0.688788f, -0.716382f, -0.689849f, -0.689849f, -0.689849f, -0.689849f, -0.689849f, -0.689849f, -0.689849f,
-    -0.689849f, -0.738669f, -0.742915f, -0.742915f, -0.696217f, -0.707891f, -0.719566f, -0.716382f, -0.713198f,
-    -0.727632f, -0.742066f, -0.751193f, -0.760320f, -0.769447f, -0.756712f, -0.753262f, -0.749813f, -0.746364f,
-    -0.742915f, -0.785367f, -0.758480f, -0.769447f, -0.782714f, -0.795980f, -0.776876f, -0.795980f, -0.793857f,
-    -0.794388f, -0.794919f, -0.795449f, -0.795980f, -0.795980f, -0.795980f, -0.804470f, -0.800225f, -0.795980f,
-    -0.795980f, -0.795980f, -0.819329f, -0.795980f, -0.795980f, -0.812961f, -0.829942f, -0.846923f, -0.849045f,
-    -0.836310f, -0.829942f, -0.836310f, -0.842677f, -0.849045f, -0.831003f, -0.835602f, -0.840083f, -0.844564f,
-    -0.849045f, -0.849045f, -0.887252f, -0.868149f, -0.849045f, -0.849045f, -0.856474f, -0.863904f, -0.855413f,
-    -0.902111f, -0.859658f, -0.883007f, -0.859658f, -0.849045f, -0.902111f, -0.902111f, -0.902111f, -0.902111f,
-    -0.874517f, -0.902111f, -0.940318f, -0.921214f, -0.902111f, -0.902111f, -0.902111f, -0.915908f, -0.909009f,
-    -0.902111f, -0.902111f, -0.937770f, -0.902111f, -0.949869f, -0.935542f, -0.921214f, -0.955176f, -0.955176f,
-    -0.955707f, -0.955176f, -0.968442f, -0.981709f, -0.994975f, -1.008241f, -0.967912f, -1.003996f, -0.955176f,
-    -0.982770f, -0.955176f, -0.955176f, -0.981709f, -0.969504f, -0.957298f, -0.973218f, -1.008241f, -1.008241f,
-    -1.008241f, -1.008241f, -1.008241f, -1.008241f, -1.008241f, -1.008241f, -1.007003f, -1.005765f, -1.008241f,
-    -1.008241f, -1.008241f, -1.008241f, -1.008241f, -1.008241f, -1.032014f, -1.034986f, -1.037958f, -1.061307f,
-    -1.051755f, -1.054939f, -1.058123f, -1.061307f, -1.060599f, -1.059891f, -1.060599f, -1.061307f, -1.045387f,
-    -1.061307f, -1.061307f, -1.061307f, -1.099514f, -1.091023f, -1.082533f, -1.061307f, -1.063429f, -1.062368f,
-    -1.061307f, -1.076519f, -1.091731f, -1.100575f, -1.098098f, -1.095622f, -1.093146f, -1.097391f, -1.105881f,
-    -1.114372f, -1.114372f, -1.117438f, -1.120504f, -1.123570f, -1.120504f, -1.117438f, -1.114372f, -1.114372f,
-    -1.128169f, -1.137190f, -1.167437f, -1.133475f, -1.167437f, -1.164253f, -1.161069f, -1.167437f, -1.146211f,
-    -1.153286f, -1.160362f, -1.167437f, -1.157885f, -1.162661f, -1.167437f, -1.167437f, -1.167437f, -1.177343f,
-    -1.167437f, -1.167437f, -1.183239f, -1.199041f, -1.214842f, -1.167437f, -1.193970f, -1.198333f, -1.202696f,
-    -1.207059f, -1.213781f, -1.220503f, -1.220503f, -1.181234f, -1.176458f, -1.171682f, -1.214135f, -1.217319f,
-    -1.220503f, -1.186541f, -1.220503f, -1.236422f, -1.241021f, -1.248804f, -1.256587f, -1.220503f, -1.221564f,
-    -1.222625f, -1.220503f, -1.273568f, -1.273568f, -1.257648f, -1.272507f, -1.247035f, -1.273568f, -1.290549f,
-    -1.307530f, -1.276752f, -1.273568f, -1.273568f, -1.273568f, -1.273568f, -1.273568f, -1.282058f, -1.273568f,
-    -1.303284f, -1.302223f, -1.297447f, -1.326633f, -1.313897f, -1.301162f, -1.304346f, -1.307530f, -1.326633f,
-    -1.313897f, -1.324511f, -1.318143f, -1.311775f, -1.305407f, -1.326633f, -1.326633f, -1.326633f, -1.326633f,
-    -1.331303f, -1.360595f, -1.328756f, -1.340961f, -1.353166f, -1.343614f, -1.359534f, -1.360595f, -1.366963f,
-    -1.373331f, -1.379698f, -1.379698f, -1.379698f, -1.379698f, -1.379698f, -1.379698f, -1.379698f, -1.379698f,
-    -1.335124f, -1.403047f, -1.379698f, -1.379698f, -1.401986f, -1.424273f, -1.410123f, -1.395972f, -1.381821f,
-    -1.390312f, -1.411538f, -1.432764f, -1.419321f, -1.413660f, -1.432764f, -1.432764f, -1.432764f, -1.432764f,
-    -1.432764f, -1.432764f, -1.432764f, -1.432764f, -1.432764f, -1.432764f, -1.443377f, -1.453990f, -1.437009f,
-    -1.453990f, -1.468848f, -1.468141f, -1.458235f, -1.467787f, -1.476808f, -1.485829f, -1.479461f, -1.463542f,
-    -1.447622f, -1.485829f, -1.485829f, -1.485829f, -1.485829f, -1.485829f, -1.485829f, -1.485829f, -1.489013f,
-    -1.502810f, -1.507055f, -1.538894f, -1.515546f, -1.490074f, -1.502810f, -1.533942f, -1.538894f, -1.538894f,
-    -1.538894f, -1.538894f, -1.538894f, -1.512362f, -1.525628f, -1.538894f, -1.509178f, -1.538894f, -1.537833f,
-    -1.538894f, -1.538894f, -1.538894f, -1.538894f, -1.538894f, -1.562243f, -1.561182f, -1.550038f, -1.538894f,
-    -1.538894f, -1.568611f, -1.587715f, -1.582054f, -1.576394f, -1.584177f, -1.591960f, -1.606818f, -1.591960f,
-    -1.591960f, -1.591960f, -1.591960f, -1.591960f, -1.604695f, -1.617431f, -1.630167f, -1.591960f, -1.607879f,
-    -1.645025f, -1.645025f, -1.645025f, -1.647047f, -1.647678f, -1.648310f, -1.648942f, -1.649574f, -1.650205f,
-    -1.650837f, -1.651469f, -1.652100f, -1.652732f, -1.653364f, -1.653996f, -1.654627f, -1.655259f, -1.655891f,
-    -1.656523f, -1.657154f, -1.657786f, -1.658418f, -1.659050f, -1.659681f, -1.660313f, -1.660945f, -1.698090f,
-    -1.698090f, -1.684293f, -1.670496f, -1.679694f, -1.688892f, -1.698090f, -1.672619f, -1.662006f, -1.680048f,
-    -1.698090f, -1.698090f, -1.707288f, -1.708527f, -1.709765f, -1.711003f, -1.712241f, -1.710826f, -1.709411f,
-    -1.707996f, -1.729576f, -1.751156f, -1.751156f, -1.751156f, -1.745319f, -1.739481f, -1.743878f, -1.747517f,
-    -1.751156f, -1.751156f, -1.751156f, -1.751156f, -1.762830f, -1.774505f, -1.762830f, -1.751156f, -1.751156f,
-    -1.768137f, -1.759646f, -1.751156f, -1.760708f, -1.770259f, -1.751156f, -1.781580f, -1.804221f, -1.804221f,
-    -1.796792f, -1.789363f, -1.796792f, -1.804221f, -1.804221f, -1.804221f, -1.804221f, -1.804221f, -1.804221f,
-    -1.804221f, -1.795731f, -1.803425f, -1.811120f, -1.830754f, -1.857286f, -1.838183f, -1.847735f, -1.857286f,
-    -1.810589f, -1.857286f, -1.857286f, -1.857286f, -1.857286f, -1.881696f, -1.842428f, -1.849857f, -1.857286f,
-    -1.857286f, -1.857286f, -1.857286f, -1.857286f, -1.864716f, -1.861001f, -1.857286f, -1.875329f, -1.893371f,
-    -1.881343f, -1.869315f, -1.857286f, -1.859409f, -1.891248f, -1.890541f, -1.881873f, -1.873206f, -1.888064f,
-    -1.906107f, -1.908229f, -1.910352f, -1.910352f, -1.910352f, -1.910352f, -1.910352f, -1.915305f, -1.920257f,
-    -1.925210f, -1.928394f, -1.935823f, -1.949620f, -1.963417f, -1.961294f, -1.941130f, -1.940599f, -1.940068f,
-    -1.931578f, -1.936354f, -1.941130f, -1.923087f, -1.936531f, -1.949974f, -1.963417f, -1.963417f, -1.963417f,
-    -1.969431f, -1.975445f, -1.981459f, -1.989950f, -1.998794f, -1.999501f, -2.006931f, -1.963417f, -1.970316f,
-    -1.977214f, -1.995787f, -2.014360f, -2.015067f, -2.015775f, -2.016482f, -2.016482f, -2.016482f, -1.982521f,
-    -2.016482f, -2.032756f, -2.016482f, -2.016482f, -2.016482f, -2.016482f, -2.016482f, -2.054689f, -2.068486f,
-    -2.041954f, -2.033463f, -2.024973f, -2.016482f, -2.016482f, -2.035586f, -2.027095f, -2.024973f, -2.051152f,
-    -2.069548f, -2.063180f, -2.069548f, -2.076977f, -2.062649f, -2.048322f, -2.069548f, -2.069548f, -2.074500f,
-    -2.079453f, -2.084406f, -2.103510f, -2.122613f, -2.122613f, -2.112796f, -2.102979f, -2.112796f, -2.122613f,
-    -2.119694f, -2.116776f, -2.108020f, -2.099264f, -2.122613f, -2.122613f, -2.118368f, -2.114123f, -2.122613f,
-    -2.112000f, -2.122613f, -2.122613f, -2.122613f, -2.122613f, -2.143309f, -2.122613f, -2.156575f, -2.175678f,
-    -2.153391f, -2.164535f, -2.175678f, -2.175678f, -2.175678f, -2.175678f, -2.175678f, -2.141717f, -2.175678f,
-    -2.175678f, -2.175678f, -2.175678f, -2.175678f, -2.185230f, -2.204334f, -2.223437f, -2.175678f, -2.175678f,
-    -2.175678f, -2.192659f, -2.192659f, -2.192659f, -2.192659f, -2.210171f, -2.227682f, -2.228213f, -2.228744f,
-    -2.224923f, -2.221102f, -2.224923f, -2.228744f, -2.227152f, -2.225560f, -2.273319f, -2.228744f, -2.247847f,
-    -2.238295f, -2.228744f, -2.228744f, -2.280748f, -2.281809f, -2.281809f, -2.258991f, -2.236173f, -2.281809f,
-    -2.281809f, -2.281809f, -2.281809f, -2.281809f, -2.281809f, -2.281809f, -2.281809f, -2.281809f, -2.281809f,
-    -2.281809f, -2.281809f, -2.281809f, -2.281809f, -2.281809f, -2.315771f, -2.303389f, -2.334874f, -2.281809f,
-    -2.289238f, -2.296667f, -2.308872f, -2.321077f, -2.334874f, -2.334874f, -2.334874f, -2.334874f, -2.334874f,
-    -2.327976f, -2.321077f, -2.346549f, -2.334874f, -2.334874f, -2.334874f, -2.334874f, -2.379449f, -2.366714f,
-    -2.353978f, -2.353978f, -2.366714f, -2.368954f, -2.371195f, -2.373435f, -2.375676f, -2.377916f, -2.380157f,
-    -2.381572f, -2.382987f, -2.381218f, -2.384579f, -2.387940f, -2.387940f, -2.387940f, -2.402798f, -2.417656f,
-    -2.407751f, -2.397845f, -2.387940f, -2.389355f, -2.390770f, -2.410581f, -2.430392f, -2.438882f, -2.409166f,
-    -2.389001f, -2.428269f, -2.434637f, -2.441005f, -2.441005f, -2.441005f, -2.439944f, -2.434637f, -2.436760f,
-    -2.438882f, -2.441005f, -2.437467f, -2.438647f, -2.439826f, -2.441005f, -2.441005f, -2.445250f, -2.443128f,
-    -2.441005f, -2.458517f, -2.453387f, -2.448257f, -2.443128f, -2.489118f, -2.453741f, -2.460816f, -2.467891f,
-    -2.474967f, -2.494070f, -2.494070f, -2.494070f, -2.494070f, -2.481335f, -2.494070f, -2.494070f, -2.494070f,
-    -2.494070f, -2.494070f, -2.471783f, -2.494070f, -2.494070f, -2.494070f, -2.494070f, -2.494070f, -2.499908f,
-    -2.505745f, -2.504683f, -2.518834f, -2.532985f, -2.499377f, -2.514412f, -2.529447f, -2.538291f, -2.547136f,
-    -2.553503f, -2.547136f, -2.550054f, -2.552973f, -2.555891f, -2.558810f, -2.547136f, -2.547136f, -2.547136f,
-    -2.547136f, -2.547136f, -2.590649f, -2.595956f, -2.568362f, -2.581628f, -2.594894f, -2.600201f, -2.547136f,
-    -2.560402f, -2.573668f, -2.586935f, -2.600201f, -2.600201f, -2.595956f, -2.600201f, -2.612406f, -2.624611f,
-    -2.612406f, -2.600201f, -2.600201f, -2.625672f, -2.607630f, -2.600201f, -2.653266f, -2.626734f, -2.600201f,
-    -2.621427f, -2.642653f, -2.633101f, -2.623550f, -2.630979f, -2.638408f, -2.645837f, -2.653266f, -2.653266f,
-    -2.653266f, -2.653266f, -2.653266f, -2.649817f, -2.646368f, -2.648667f, -2.650967f, -2.653266f, -2.676615f,
-    -2.688289f, -2.699964f, -2.657512f, -2.675978f, -2.694445f, -2.706332f, -2.692004f, -2.677676f, -2.687759f,
-    -2.697841f, -2.706332f, -2.706332f, -2.706332f, -2.706332f, -2.706332f, -2.706332f, -2.706332f, -2.706332f,
-    -2.706332f, -2.733926f, -2.706332f, -2.706332f, -2.751968f, -2.729680f, -2.724374f, -2.706332f, -2.711108f,
-    -2.715883f, -2.720659f, -2.725435f, -2.727558f, -2.729680f, -2.735694f, -2.741709f, -2.750553f, -2.759397f,
-    -2.759397f, -2.759397f, -2.759397f, -2.759397f, -2.759397f, -2.774963f, -2.790529f, -2.806094f, -2.801053f,
-    -2.796012f, -2.790971f, -2.785930f, -2.777085f, -2.768241f, -2.759397f, -2.785930f, -2.812462f, -2.805564f,
-    -2.798665f, -2.788052f, -2.812462f, -2.812462f, -2.812462f, -2.802557f, -2.805033f, -2.807510f, -2.809986f,
-    -2.812462f, -2.812462f, -2.812462f, -2.814467f, -2.816472f, -2.818476f, -2.817592f, -2.816708f, -2.847839f,
-    -2.852261f, -2.856683f, -2.861105f, -2.865528f, -2.865528f, -2.865528f, -2.865528f, -2.842179f, -2.853853f,
-    -2.865528f, -2.865528f, -2.865528f, -2.870622f, -2.875716f, -2.880810f, -2.885905f, -2.890999f, -2.896093f,
-    -2.901188f, -2.906282f, -2.911376f, -2.916470f, -2.865528f, -2.871895f, -2.878263f, -2.865528f, -2.892060f,
-    -2.889938f, -2.900551f, -2.865528f, -2.901612f, -2.871895f, -2.886223f, -2.900551f, -2.896305f, -2.892060f,
-    -2.918593f, -2.865528f, -2.887815f, -2.910102f, -2.936635f, -2.963168f, -2.938404f, -2.913640f, -2.918593f,
-    -2.918593f, -2.918593f, -2.918593f, -2.922042f, -2.925491f, -2.928941f, -2.932390f, -2.925491f, -2.918593f,
-    -2.923899f, -2.918593f, -2.918593f, -2.965290f, -2.959984f, -2.954677f, -2.962106f, -2.971658f, -2.971658f,
-    -2.927083f, -2.934513f, -2.941942f, -2.949371f, -2.956800f, -2.964229f, -2.971658f, -2.971658f, -2.959984f,
-    -2.963875f, -2.967767f, -2.971658f, -2.984394f, -2.976965f, -3.000314f, -2.971658f, -2.998191f, -3.003497f,
-    -3.008804f, -3.014111f, -3.021540f, -3.022601f, -3.023662f, -3.024724f, -3.024724f, -3.024724f, -3.024724f,
-    -3.021752f, -3.018780f, -3.015809f, -3.038167f, -3.037931f, -3.037695f, -3.037459f, -3.024724f, -3.051256f,
-    -3.024724f, -3.024724f, -3.024724f, -3.024724f, -3.032153f, -3.028438f, -3.024724f, -3.043827f, -3.049134f,
-    -3.054440f, -3.043827f, -3.051964f, -3.060100f, -3.068945f, -3.077789f, -3.122364f, -3.077789f, -3.077789f,
-    -3.077789f, -3.077789f, -3.077789f, -3.077789f, -3.077789f, -3.077789f, -3.091586f, -3.091232f, -3.130854f,
-    -3.120241f, -3.109628f, -3.094770f, -3.079912f, -3.103260f, -3.126609f, -3.102199f, -3.077789f, -3.109628f,
-    -3.130854f, -3.130854f, -3.130854f, -3.152080f, -3.130854f, -3.130854f, -3.130854f, -3.130854f, -3.130854f,
-    -3.130854f, -3.130854f, -3.130854f, -3.130854f, -3.130854f, -3.130854f, -3.161986f, -3.168590f, -3.175193f,
-    -3.181797f, -3.175429f, -3.169061f, -3.162693f, -3.158448f, -3.183920f, -3.180736f, -3.165347f, -3.149958f,
-    -3.166939f, -3.183920f, -3.183920f, -3.183920f, -3.183920f, -3.183920f, -3.183920f, -3.183920f, -3.183920f,
-    -3.183920f, -3.183920f, -3.183920f, -3.183920f, -3.183920f, -3.197186f, -3.210452f, -3.224249f, -3.234862f,
-    -3.235570f, -3.236277f, -3.236985f, -3.183920f, -3.210452f, -3.236985f, -3.231678f, -3.236985f, -3.226372f,
-    -3.236985f, -3.236985f, -3.236985f, -3.236985f, -3.236985f, -3.236985f, -3.236985f, -3.236985f, -3.236985f,
-    -3.248659f, -3.260334f, -3.256088f, -3.251843f, -3.236985f, -3.262456f, -3.272362f, -3.249721f, -3.290050f,
-    -3.247598f, -3.290050f, -3.290050f, -3.276784f, -3.263518f, -3.276784f, -3.290050f, -3.290050f, -3.290050f,
-    -3.290050f, -3.290050f, -3.290050f, -3.290050f, -3.290050f, -3.290050f, -3.290050f, -3.290050f, -3.290050f,
-    -3.290050f, -3.290050f, -3.300663f, -3.303670f, -3.306677f, -3.309684f, -3.312691f, -3.321536f, -3.330380f,
-    -3.336748f, -3.343116f, -3.343116f, -3.343116f, -3.343116f, -3.343116f, -3.343116f, -3.343116f, -3.343116f,
-    -3.343116f, -3.343381f, -3.343646f, -3.343912f, -3.344177f, -3.343116f, -3.391936f, -3.367526f, -3.343116f,
-    -3.341347f, -3.343116f, -3.396181f, -3.396181f, -3.396181f, -3.396181f, -3.396181f, -3.394058f, -3.391936f,
-    -3.389813f, -3.370356f, -3.350898f, -3.373540f, -3.396181f, -3.396181f, -3.396181f, -3.396181f, -3.396181f,
-    -3.377785f, -3.396181f, -3.396181f, -3.396181f, -3.396181f, -3.396181f, -3.396888f, -3.397596f, -3.398303f,
-    -3.397596f, -3.396888f, -3.396181f, -3.402549f, -3.397242f, -3.413869f, -3.400426f, -3.403787f, -3.407148f,
-    -3.410509f, -3.413869f, -3.405025f, -3.396181f, -3.415815f, -3.435449f, -3.438633f, -3.441817f, -3.449246f,
-    -3.438633f, -3.448185f, -3.457737f, -3.417407f, -3.447124f, -3.449246f, -3.451369f, -3.453491f, -3.432265f,
-    -3.449246f, -3.449246f, -3.449246f, -3.449246f, -3.449246f, -3.473656f, -3.461451f, -3.449246f, -3.460921f,
-    -3.449246f, -3.468350f, -3.477194f, -3.486038f, -3.494882f, -3.502312f, -3.475779f, -3.449246f, -3.502312f,
-    -3.502312f, -3.502312f, -3.502312f, -3.502312f, -3.500189f, -3.498066f, -3.451369f, -3.464812f, -3.478255f,
-    -3.491698f, -3.497005f, -3.502312f, -3.555377f, -3.502312f, -3.510271f, -3.518231f, -3.526191f, -3.534151f,
-    -3.506557f, -3.523538f, -3.524599f, -3.525660f, -3.502312f, -3.517435f, -3.532559f, -3.540165f, -3.547771f,
-    -3.555377f, -3.555377f, -3.551132f, -3.546886f, -3.542641f, -3.546886f, -3.551132f, -3.555377f, -3.533443f,
-    -3.544410f, -3.555377f, -3.555377f, -3.555377f, -3.555377f, -3.555377f, -3.555377f, -3.555377f, -3.555377f,
-    -3.555377f, -3.555377f, -3.608442f, -3.599686f, -3.590931f, -3.582175f, -3.573419f, -3.564398f, -3.555377f,
-    -3.555377f, -3.555377f, -3.597122f, -3.602782f, -3.608442f, -3.595706f, -3.602074f, -3.608442f, -3.580848f,
-    -3.555377f, -3.581910f, -3.608442f, -3.608442f, -3.608442f, -3.608442f, -3.608442f, -3.608442f, -3.608442f,
-    -3.608442f, -3.608442f, -3.608442f, -3.608442f, -3.616023f, -3.623604f, -3.631184f, -3.638765f, -3.646346f,
-    -3.653927f, -3.661508f, -3.653017f, -3.644527f, -3.642404f, -3.640281f, -3.608442f, -3.637451f, -3.661507f,
-    -3.648772f, -3.648772f, -3.648772f, -3.648772f, -3.648772f, -3.644527f, -3.640281f, -3.636036f, -3.659385f,
-    -3.661507f, -3.661507f, -3.661507f, -3.661507f, -3.642404f, -3.647003f, -3.651602f, -3.665753f, -3.664338f,
-    -3.662923f, -3.661507f, -3.661507f, -3.661507f, -3.661507f, -3.661507f, -3.661508f, -3.661508f, -3.661507f,
-    -3.661508f, -3.661508f, -3.678223f, -3.694939f, -3.697857f, -3.700776f, -3.689101f, -3.697592f, -3.706082f,
-    -3.714573f, -3.714573f, -3.714573f, -3.714573f, -3.714573f, -3.714573f, -3.714573f, -3.714573f, -3.714573f,
-    -3.733676f, -3.752780f, -3.714573f, -3.723063f, -3.723329f, -3.723594f, -3.723859f, -3.724125f, -3.735799f,
-    -3.730492f, -3.725186f, -3.719879f, -3.714573f, -3.723063f, -3.714573f, -3.767638f, -3.731554f, -3.717757f,
-    -3.721648f, -3.725540f, -3.729431f, -3.714573f, -3.732261f, -3.749950f, -3.767638f, -3.766577f, -3.765516f,
-    -3.766046f, -3.766577f, -3.767107f, -3.767638f, -3.767638f, -3.767638f, -3.767638f, -3.767638f, -3.767638f,
-    -3.767638f, -3.771277f, -3.774916f, -3.778554f, -3.782193f, -3.785832f, -3.789471f, -3.793110f, -3.802661f,
-    -3.794701f, -3.786742f, -3.800539f, -3.802838f, -3.805138f, -3.795763f, -3.786388f, -3.777013f, -3.767638f,
-    -3.784619f, -3.820703f, -3.790987f, -3.805845f, -3.820703f, -3.793110f, -3.820703f, -3.822030f, -3.823357f,
-    -3.824683f, -3.826010f, -3.825678f, -3.825347f, -3.825015f, -3.824683f, -3.824352f, -3.824020f, -3.823688f,
-    -3.823357f, -3.823025f, -3.822693f, -3.822362f, -3.822030f, -3.821698f, -3.821367f, -3.821035f, -3.820703f,
-    -3.820703f, -3.841930f, -3.831317f, -3.820703f, -3.830255f, -3.839807f, -3.820703f, -3.822826f, -3.824949f,
-    -3.827071f, -3.826010f, -3.824949f, -3.841222f, -3.857495f, -3.873769f, -3.870585f, -3.867401f, -3.858911f,
-    -3.873769f, -3.873769f, -3.873769f, -3.873769f, -3.873769f, -3.873769f, -3.873769f, -3.873769f, -3.873769f,
-    -3.873769f, -3.873769f, -3.873769f, -3.873769f, -3.873769f, -3.873769f, -3.873769f, -3.885443f, -3.890750f,
-    -3.892872f, -3.894995f, -3.916221f, -3.878014f, -3.885089f, -3.892165f, -3.899240f, -3.906316f, -3.913391f,
-    -3.920466f, -3.873769f, -3.873769f, -3.892342f, -3.910915f, -3.918344f, -3.902070f, -3.910325f, -3.918580f,
-    -3.926834f, -3.926834f, -3.926834f, -3.926834f, -3.926834f, -3.926834f, -3.926834f, -3.926834f, -3.926834f,
-    -3.937801f, -3.948768f, -3.940985f, -3.933202f, -3.937447f, -3.934794f, -3.932141f, -3.929487f, -3.926834f,
-    -3.930814f, -3.934794f, -3.938774f, -3.942754f, -3.943815f, -3.935325f, -3.926834f, -3.953367f, -3.979899f,
-    -3.943815f, -3.979899f, -3.979899f, -3.979899f, -3.971055f, -3.962211f, -3.953367f, -3.944523f, -3.935678f,
-    -3.926834f, -3.949122f, -3.971409f, -3.970878f, -3.970348f, -3.969817f, -3.984145f, -3.983296f, -3.982447f,
-    -3.981598f, -3.980748f, -3.979899f, -3.967164f, -3.954428f, -3.941692f, -3.928957f, -3.979899f, -3.979899f,
-    -3.979899f, -3.979899f, -3.979899f, -3.979899f, -3.979899f, -3.979899f, -4.015984f, -3.979899f, -3.997588f,
-    -4.015276f, -4.032965f, -4.017045f, -4.025005f, -4.032965f, -4.015984f, -3.999003f, -4.010324f, -4.021644f,
-    -4.032965f, -4.001126f, -4.015984f, -4.026597f, -4.028189f, -4.029781f, -4.031373f, -4.032965f, -4.032965f,
-    -4.032965f, -4.032965f, -4.032965f, -4.032965f, -4.032965f, -4.032965f, -4.032965f, -4.032965f, -4.032965f,
-    -4.032965f, -4.037210f, -4.041455f, -4.045700f, -4.039333f, -4.032965f, -4.032965f, -4.032965f, -4.032965f,
-    -4.032965f, -4.036679f, -4.040394f, -4.044108f, -4.047823f, -4.035087f, -4.046054f, -4.057021f, -4.069049f,
-    -4.064273f, -4.059497f, -4.063920f, -4.068342f, -4.072764f, -4.077186f, -4.081608f, -4.086030f, -4.086030f,
-    -4.086030f, -4.086030f, -4.086030f, -4.086030f, -4.086030f, -4.086030f, -4.086030f, -4.086030f, -4.086030f,
-    -4.086030f, -4.065865f, -4.086030f, -4.086030f, -4.086030f, -4.086030f, -4.086030f, -4.086030f, -4.086030f,
-    -4.126360f, -4.106195f, -4.086030f, -4.112563f, -4.114155f, -4.115747f, -4.111501f, -4.107256f, -4.117869f,
-    -4.128482f, -4.139095f, -4.133435f, -4.127775f, -4.122115f, -4.122822f, -4.105134f, -4.139095f, -4.139095f,
-    -4.139095f, -4.139095f, -4.139095f, -4.139095f, -4.139095f, -4.139095f, -4.139095f, -4.139095f, -4.139095f,
-    -4.129190f, -4.119284f, -4.109379f, -4.103011f, -4.096643f, -4.090275f, -4.114685f, -4.139095f, -4.159260f,
-    -4.149178f, -4.139095f, -4.151831f, -4.139095f, -4.141622f, -4.144149f, -4.146676f, -4.149203f, -4.151730f,
-    -4.154257f, -4.156784f, -4.190038f, -4.158199f, -4.161171f, -4.164142f, -4.167114f, -4.170086f, -4.173057f,
-    -4.180133f, -4.186147f, -4.192161f, -4.188977f, -4.185793f, -4.187916f, -4.190038f, -4.192161f, -4.139095f,
-    -4.156784f, -4.174472f, -4.192161f, -4.193753f, -4.195345f, -4.193753f, -4.192161f, -4.192161f, -4.192161f,
-    -4.192161f, -4.192161f, -4.192161f, -4.192161f, -4.192161f, -4.201713f, -4.211264f, -4.220816f, -4.230368f,
-    -4.245226f, -4.178364f, -4.185262f, -4.192161f, -4.192161f, -4.192161f, -4.218693f, -4.245226f, -4.245226f,
-    -4.245226f, -4.245226f, -4.215509f, -4.228245f, -4.220462f, -4.212679f, -4.204896f, -4.226123f, -4.225061f,
-    -4.224000f, -4.245226f, -4.228245f, -4.236736f, -4.245226f, -4.245226f, -4.245226f, -4.245226f, -4.245226f,
-    -4.245226f, -4.245226f, -4.245226f, -4.192161f, -4.209849f, -4.227538f, -4.245226f, -4.245226f, -4.245226f,
-    -4.245226f, -4.245226f, -4.245226f, -4.245226f, -4.245226f, -4.245226f, -4.245226f, -4.245226f, -4.245226f,
-    -4.245226f, -4.245226f, -4.245226f, -4.245226f, -4.256193f, -4.267160f, -4.245226f, -4.264330f, -4.283433f,
-    -4.278127f, -4.272820f, -4.267514f, -4.262207f, -4.279188f, -4.296169f, -4.295638f, -4.295107f, -4.294577f,
-    -4.294046f, -4.295107f, -4.296169f, -4.297230f, -4.298291f, -4.264330f, -4.272820f, -4.281311f, -4.289801f,
-    -4.298291f, -4.298291f, -4.298291f, -4.298291f, -4.298291f, -4.298291f, -4.298291f, -4.298291f, -4.303244f,
-    -4.308197f, -4.298291f, -4.298291f, -4.298291f, -4.319518f, -4.298291f, -4.298291f, -4.298291f, -4.303386f,
-    -4.308480f, -4.313574f, -4.318668f, -4.323763f, -4.321994f, -4.320225f, -4.318456f, -4.324824f, -4.318191f,
-    -4.311558f, -4.304925f, -4.298291f, -4.298291f, -4.315980f, -4.333668f, -4.351357f, -4.346050f, -4.340744f,
-    -4.335437f, -4.340744f, -4.346050f, -4.351357f, -4.349234f, -4.347112f, -4.344989f, -4.343928f, -4.342866f,
-    -4.344989f, -4.347112f, -4.349234f, -4.351357f, -4.351357f, -4.351357f, -4.351357f, -4.351357f, -4.351357f,
-    -4.351357f, -4.351357f, -4.351357f, -4.351357f, -4.357194f, -4.363031f, -4.375767f, -4.388502f, -4.369930f,
-    -4.351357f, -4.351357f, -4.355602f, -4.359847f, -4.364092f, -4.368338f, -4.367630f, -4.366923f, -4.366215f,
-    -4.361970f, -4.357725f, -4.395224f, -4.396639f, -4.398054f, -4.399469f, -4.400884f, -4.402299f, -4.376828f,
-    -4.351357f, -4.369045f, -4.386734f, -4.404422f, -4.372583f, -4.370460f, -4.368338f, -4.386380f, -4.404422f,
-    -4.404422f, -4.404422f, -4.404422f, -4.404422f, -4.404422f, -4.404422f, -4.404422f, -4.404422f, -4.404422f,
-    -4.404422f, -4.404422f, -4.404422f, -4.404422f, -4.404422f, -4.412913f, -4.421403f, -4.429893f, -4.421403f,
-    -4.412913f, -4.404422f, -4.404422f, -4.404422f, -4.404422f, -4.421403f, -4.438384f, -4.455365f, -4.456426f,
-    -4.457487f, -4.448997f, -4.440506f, -4.432016f, -4.457487f, -4.442629f, -4.419280f, -4.421934f, -4.424587f,
-    -4.426709f, -4.428832f, -4.430955f, -4.433077f, -4.441214f, -4.449351f, -4.457487f, -4.448466f, -4.439445f,
-    -4.430424f, -4.421403f, -4.443690f, -4.465978f, -4.463148f, -4.460318f, -4.457487f, -4.457487f, -4.457487f,
-    -4.457487f, -4.457487f, -4.472346f, -4.487204f, -4.502062f, -4.457487f, -4.457487f, -4.457487f, -4.626574f,
-    -4.795660f };
+const int16_t ADC_LUT_MV[4096] = {
+     4968,  4892,  4816,  4818,  4820,  4822,  4824,  4827,  4801,  4776,  4829,  4782,
+     4776,  4782,  4788,  4794,  4788,  4782,  4776,  4776,  4780,  4784,  4776,  4776,
+     4776,  4776,  4763,  4770,  4776,  4763,  4749,  4776,  4776,  4749,  4723,  4775,
+     4740,  4733,  4727,  4725,  4723,  4723,  4723,  4731,  4678,  4693,  4708,  4723,
+     4714,  4718,  4723,  4696,  4695,  4693,  4691,  4710,  4690,  4670,  4670,  4670,
+     4671,  4672,  4673,  4670,  4656,  4670,  4645,  4653,  4662,  4670,  4670,  4644,
+     4644,  4644,  4644,  4630,  4617,  4623,  4670,  4647,  4624,  4617,  4617,  4617,
+     4617,  4617,  4617,  4603,  4607,  4612,  4617,  4617,  4617,  4603,  4590,  4578,
+     4598,  4617,  4564,  4564,  4589,  4564,  4564,  4608,  4586,  4564,  4553,  4558,
+     4564,  4564,  4547,  4544,  4541,  4537,  4533,  4541,  4549,  4534,  4526,  4519,
+     4511,  4519,  4528,  4511,  4511,  4511,  4511,  4505,  4500,  4511,  4494,  4495,
+     4485,  4474,  4484,  4483,  4482,  4481,  4457,  4477,  4470,  4464,  4457,  4508,
+     4470,  4464,  4457,  4457,  4457,  4457,  4457,  4457,  4457,  4456,  4455,  4457,
+     4431,  4404,  4450,  4427,  4404,  4419,  4436,  4413,  4443,  4431,  4404,  4404,
+     4404,  4404,  4404,  4403,  4401,  4404,  4402,  4399,  4396,  4361,  4392,  4391,
+     4390,  4393,  4368,  4351,  4351,  4351,  4351,  4351,  4351,  4351,  4351,  4351,
+     4305,  4351,  4309,  4385,  4332,  4351,  4333,  4334,  4334,  4334,  4329,  4326,
+     4322,  4317,  4313,  4307,  4289,  4281,  4290,  4298,  4295,  4291,  4298,  4279,
+     4289,  4298,  4265,  4296,  4245,  4245,  4245,  4258,  4245,  4245,  4245,  4209,
+     4245,  4235,  4220,  4247,  4260,  4272,  4232,  4245,  4227,  4208,  4210,  4212,
+     4215,  4192,  4192,  4228,  4229,  4230,  4192,  4192,  4192,  4192,  4192,  4192,
+     4192,  4208,  4148,  4192,  4207,  4184,  4175,  4166,  4158,  4149,  4141,  4171,
+     4181,  4191,  4174,  4156,  4139,  4139,  4139,  4139,  4147,  4124,  4139,  4139,
+     4086,  4113,  4139,  4122,  4129,  4136,  4120,  4121,  4122,  4123,  4114,  4086,
+     4086,  4086,  4099,  4095,  4090,  4086,  4086,  4065,  4086,  4086,  4083,  4080,
+     4086,  4078,  4082,  4086,  4080,  4049,  4033,  4059,  4063,  4033,  4033,  4033,
+     4033,  4033,  4033,  4033,  4033,  4033,  4037,  4035,  4033,  4033,  4033,  3988,
+     3994,  4000,  4006,  3989,  3986,  3983,  3980,  3995,  3980,  4015,  3999,  3982,
+     3983,  3980,  3980,  3980,  3927,  3980,  3980,  3980,  3980,  3966,  3952,  3976,
+     3957,  3937,  3935,  3927,  3930,  3927,  3927,  3927,  3927,  3927,  3927,  3927,
+     3927,  3927,  3927,  3908,  3889,  3912,  3927,  3927,  3896,  3874,  3927,  3874,
+     3884,  3894,  3869,  3867,  3865,  3863,  3854,  3874,  3874,  3874,  3874,  3859,
+     3847,  3833,  3821,  3827,  3826,  3825,  3836,  3847,  3834,  3821,  3821,  3821,
+     3821,  3821,  3821,  3821,  3822,  3821,  3778,  3821,  3821,  3803,  3812,  3768,
+     3771,  3775,  3774,  3772,  3771,  3769,  3785,  3776,  3768,  3780,  3768,  3768,
+     3758,  3747,  3768,  3768,  3768,  3768,  3768,  3729,  3768,  3750,  3761,  3750,
+     3738,  3719,  3715,  3715,  3715,  3715,  3741,  3715,  3722,  3706,  3689,  3689,
+     3702,  3715,  3715,  3712,  3710,  3688,  3697,  3679,  3662,  3662,  3662,  3671,
+     3666,  3662,  3662,  3662,  3662,  3662,  3662,  3662,  3656,  3633,  3662,  3628,
+     3638,  3623,  3608,  3608,  3608,  3608,  3608,  3635,  3622,  3608,  3608,  3608,
+     3608,  3608,  3608,  3605,  3600,  3596,  3582,  3569,  3573,  3578,  3582,  3555,
+     3579,  3602,  3564,  3608,  3548,  3572,  3555,  3586,  3571,  3555,  3555,  3529,
+     3502,  3535,  3530,  3523,  3516,  3510,  3543,  3507,  3508,  3510,  3512,  3514,
+     3516,  3518,  3520,  3521,  3523,  3525,  3527,  3529,  3502,  3502,  3502,  3502,
+     3498,  3500,  3502,  3502,  3476,  3502,  3496,  3491,  3485,  3479,  3463,  3466,
+     3469,  3472,  3502,  3485,  3467,  3449,  3449,  3449,  3449,  3449,  3449,  3443,
+     3437,  3430,  3449,  3446,  3443,  3449,  3423,  3396,  3413,  3418,  3412,  3405,
+     3402,  3399,  3396,  3391,  3385,  3379,  3387,  3395,  3396,  3396,  3343,  3343,
+     3365,  3383,  3396,  3372,  3343,  3356,  3370,  3343,  3343,  3343,  3343,  3343,
+     3343,  3343,  3343,  3320,  3343,  3317,  3290,  3343,  3323,  3303,  3339,  3327,
+     3315,  3302,  3290,  3290,  3290,  3317,  3290,  3290,  3290,  3290,  3294,  3298,
+     3295,  3293,  3290,  3290,  3290,  3290,  3237,  3290,  3265,  3289,  3257,  3251,
+     3244,  3237,  3237,  3237,  3237,  3237,  3237,  3237,  3224,  3212,  3237,  3228,
+     3237,  3222,  3214,  3205,  3197,  3204,  3184,  3237,  3184,  3184,  3184,  3184,
+     3184,  3184,  3184,  3167,  3175,  3184,  3184,  3178,  3167,  3184,  3131,  3136,
+     3154,  3131,  3153,  3175,  3153,  3131,  3131,  3133,  3154,  3131,  3124,  3117,
+     3116,  3114,  3106,  3124,  3131,  3130,  3130,  3112,  3095,  3078,  3104,  3110,
+     3103,  3095,  3086,  3078,  3094,  3078,  3065,  3051,  3078,  3078,  3078,  3078,
+     3065,  3051,  3027,  3052,  3078,  3062,  3047,  3044,  3051,  3076,  3050,  3025,
+     3037,  3078,  3025,  3025,  3037,  3049,  3025,  3025,  3025,  3025,  3025,  3025,
+     3003,  2983,  2987,  2982,  2977,  2972,  2987,  2992,  2992,  2992,  2992,  2972,
+     2957,  2972,  2970,  2967,  2965,  2972,  2947,  2972,  2972,  2972,  2972,  2940,
+     2956,  2972,  2943,  2937,  2930,  2924,  2919,  2919,  2919,  2919,  2919,  2919,
+     2907,  2896,  2905,  2914,  2913,  2911,  2888,  2895,  2902,  2902,  2903,  2910,
+     2866,  2866,  2866,  2838,  2845,  2852,  2880,  2908,  2887,  2866,  2866,  2864,
+     2863,  2866,  2857,  2849,  2837,  2849,  2822,  2817,  2812,  2823,  2812,  2812,
+     2800,  2787,  2812,  2812,  2812,  2812,  2800,  2787,  2812,  2812,  2812,  2812,
+     2793,  2776,  2786,  2797,  2801,  2806,  2759,  2759,  2765,  2771,  2776,  2759,
+     2766,  2759,  2759,  2745,  2730,  2742,  2759,  2756,  2754,  2751,  2748,  2759,
+     2723,  2728,  2733,  2728,  2706,  2733,  2724,  2716,  2706,  2706,  2706,  2700,
+     2707,  2714,  2721,  2706,  2706,  2706,  2680,  2654,  2677,  2656,  2685,  2672,
+     2660,  2676,  2653,  2611,  2625,  2639,  2653,  2641,  2653,  2653,  2653,  2645,
+     2649,  2653,  2645,  2602,  2625,  2604,  2607,  2627,  2613,  2600,  2603,  2607,
+     2618,  2611,  2600,  2600,  2600,  2595,  2598,  2600,  2600,  2600,  2600,  2585,
+     2570,  2556,  2577,  2590,  2578,  2566,  2600,  2580,  2547,  2568,  2543,  2509,
+     2528,  2547,  2570,  2541,  2544,  2547,  2507,  2520,  2529,  2538,  2547,  2539,
+     2515,  2513,  2547,  2547,  2494,  2494,  2494,  2494,  2494,  2494,  2494,  2494,
+     2494,  2494,  2494,  2481,  2469,  2483,  2475,  2494,  2492,  2492,  2493,  2494,
+     2494,  2457,  2452,  2461,  2470,  2463,  2456,  2449,  2435,  2441,  2441,  2441,
+     2441,  2441,  2441,  2441,  2388,  2391,  2394,  2398,  2401,  2404,  2388,  2389,
+     2388,  2404,  2396,  2388,  2343,  2388,  2388,  2388,  2388,  2388,  2388,  2388,
+     2388,  2369,  2365,  2367,  2369,  2352,  2365,  2354,  2335,  2335,  2335,  2335,
+     2335,  2335,  2335,  2335,  2335,  2335,  2335,  2335,  2322,  2335,  2335,  2326,
+     2317,  2308,  2327,  2282,  2307,  2333,  2314,  2335,  2335,  2282,  2282,  2282,
+     2283,  2282,  2282,  2282,  2282,  2282,  2282,  2274,  2278,  2282,  2261,  2240,
+     2241,  2241,  2282,  2243,  2241,  2239,  2237,  2235,  2233,  2231,  2230,  2228,
+     2226,  2224,  2222,  2229,  2229,  2229,  2229,  2229,  2224,  2254,  2228,  2202,
+     2215,  2229,  2210,  2191,  2188,  2185,  2183,  2191,  2192,  2193,  2184,  2176,
+     2213,  2194,  2176,  2146,  2176,  2176,  2176,  2168,  2176,  2174,  2168,  2163,
+     2149,  2155,  2161,  2123,  2137,  2130,  2123,  2123,  2123,  2123,  2123,  2123,
+     2123,  2123,  2116,  2108,  2101,  2114,  2120,  2113,  2106,  2082,  2083,  2084,
+     2082,  2080,  2078,  2075,  2072,  2070,  2070,  2070,  2070,  2070,  2070,  2070,
+     2047,  2052,  2029,  2019,  2044,  2070,  2058,  2030,  2028,  2027,  2025,  2030,
+     2036,  2041,  2016,  2016,  2016,  2016,  2016,  2016,  1993,  1988,  1983,  2012,
+     2014,  2016,  1999,  2016,  1989,  1999,  2009,  1983,  1963,  1963,  1966,  1963,
+     1972,  1980,  1963,  1963,  1960,  1956,  1952,  1963,  1944,  1954,  1963,  1959,
+     1954,  1951,  1929,  1944,  1927,  1910,  1910,  1910,  1910,  1910,  1910,  1910,
+     1955,  1864,  1910,  1895,  1880,  1905,  1903,  1902,  1899,  1897,  1885,  1895,
+     1857,  1857,  1857,  1877,  1883,  1889,  1866,  1868,  1838,  1857,  1857,  1857,
+     1851,  1857,  1835,  1813,  1822,  1831,  1821,  1812,  1838,  1855,  1849,  1842,
+     1815,  1791,  1804,  1772,  1799,  1802,  1804,  1806,  1772,  1784,  1796,  1804,
+     1795,  1787,  1782,  1778,  1804,  1781,  1768,  1751,  1751,  1751,  1751,  1751,
+     1751,  1751,  1763,  1775,  1787,  1751,  1751,  1775,  1743,  1743,  1745,  1732,
+     1698,  1741,  1720,  1722,  1723,  1725,  1712,  1698,  1736,  1717,  1698,  1709,
+     1703,  1698,  1698,  1698,  1679,  1698,  1672,  1673,  1675,  1677,  1690,  1682,
+     1675,  1676,  1668,  1659,  1651,  1645,  1645,  1645,  1660,  1605,  1632,  1603,
+     1622,  1641,  1645,  1645,  1640,  1634,  1629,  1617,  1615,  1595,  1600,  1605,
+     1598,  1592,  1592,  1592,  1592,  1592,  1592,  1592,  1592,  1592,  1592,  1592,
+     1572,  1592,  1571,  1578,  1585,  1592,  1539,  1581,  1571,  1561,  1551,  1547,
+     1543,  1539,  1539,  1539,  1539,  1539,  1528,  1539,  1539,  1539,  1494,  1539,
+     1539,  1539,  1539,  1512,  1508,  1504,  1500,  1494,  1488,  1486,  1486,  1486,
+     1486,  1486,  1486,  1486,  1477,  1469,  1460,  1486,  1477,  1469,  1461,  1454,
+     1449,  1433,  1433,  1433,  1433,  1433,  1433,  1433,  1433,  1433,  1433,  1420,
+     1433,  1427,  1421,  1416,  1421,  1403,  1413,  1422,  1386,  1419,  1399,  1380,
+     1380,  1380,  1380,  1380,  1380,  1380,  1380,  1380,  1353,  1380,  1380,  1380,
+     1353,  1349,  1375,  1367,  1359,  1351,  1343,  1327,  1327,  1330,  1334,  1327,
+     1328,  1323,  1327,  1313,  1300,  1327,  1274,  1327,  1326,  1325,  1327,  1327,
+     1327,  1274,  1288,  1274,  1274,  1274,  1274,  1274,  1274,  1274,  1274,  1274,
+     1274,  1274,  1274,  1274,  1233,  1274,  1270,  1267,  1262,  1221,  1221,  1221,
+     1231,  1242,  1224,  1221,  1235,  1250,  1235,  1221,  1269,  1221,  1221,  1221,
+     1191,  1221,  1221,  1221,  1194,  1167,  1194,  1204,  1218,  1167,  1210,  1201,
+     1177,  1196,  1214,  1191,  1168,  1167,  1167,  1159,  1150,  1141,  1156,  1153,
+     1151,  1148,  1114,  1167,  1149,  1131,  1155,  1120,  1114,  1114,  1114,  1121,
+     1119,  1117,  1114,  1109,  1114,  1114,  1114,  1114,  1108,  1102,  1088,  1114,
+     1086,  1074,  1061,  1073,  1069,  1066,  1071,  1077,  1069,  1061,  1061,  1061,
+     1061,  1061,  1059,  1059,  1057,  1055,  1042,  1031,  1020,  1008,  1021,  1021,
+     1021,  1021,  1008,  1016,  1024,  1032,  1039,  1008,  1008,  1003,   998,   993,
+      985,   976,   992,  1008,  1004,  1000,   997,   973,   965,   957,   956,   955,
+      954,   953,   952,   951,   950,   949,   948,   948,   947,   946,   945,   944,
+      943,   942,   942,   941,   940,   939,   938,   902,   934,   945,   955,   899,
+      909,   919,   877,   889,   902,   902,   902,   902,   902,   902,   902,   902,
+      902,   889,   876,   889,   902,   875,   872,   880,   887,   881,   876,   858,
+      843,   846,   849,   849,   849,   849,   849,   849,   846,   843,   839,   849,
+      849,   801,   806,   811,   814,   796,   813,   807,   802,   796,   768,   768,
+      767,   766,   811,   784,   796,   796,   769,   743,   783,   744,   764,   754,
+      743,   743,   743,   743,   743,   743,   743,   743,   743,   743,   743,   720,
+      722,   719,   716,   743,   742,   741,   690,   708,   725,   743,   692,   690,
+      690,   728,   716,   715,   686,   690,   690,   690,   688,   687,   686,   684,
+      687,   690,   638,   655,   673,   690,   690,   658,   637,   637,   637,   637,
+      637,   637,   637,   637,   637,   637,   627,   632,   637,   627,   618,   587,
+      593,   600,   584,   584,   637,   584,   590,   588,   586,   584,   584,   584,
+      584,   584,   584,   584,   584,   539,   561,   584,   557,   552,   554,   550,
+      545,   541,   536,   531,   531,   531,   550,   569,   531,   531,   531,   505,
+      518,   531,   523,   504,   499,   495,   489,   484,   482,   480,   478,   478,
+      478,   485,   492,   478,   478,   478,   478,   478,   478,   478,   472,   466,
+      456,   448,   439,   442,   444,   434,   425,   425,   425,   425,   425,   425,
+      427,   429,   431,   434,   465,   425,   425,   445,   425,   401,   402,   388,
+      397,   406,   416,   425,   414,   404,   388,   371,   371,   385,   371,   372,
+      372,   346,   334,   323,   338,   354,   353,   353,   353,   352,   335,   318,
+      322,   325,   327,   330,   321,   319,   318,   318,   318,   318,   318,   316,
+      313,   310,   308,   307,   306,   305,   265,   276,   291,   265,   265,   265,
+      265,   265,   265,   265,   265,   265,   265,   248,   230,   212,   243,   253,
+      263,   239,   221,   212,   214,   217,   219,   212,   224,   236,   212,   212,
+      212,   212,   212,   212,   199,   190,   187,   212,   212,   159,   174,   208,
+      212,   194,   176,   201,   188,   175,   162,   180,   154,   159,   159,   159,
+      159,   159,   159,   159,   121,   159,   133,   119,   106,   133,   149,   133,
+      130,   119,   108,   106,   106,   106,   106,   106,   131,   155,   110,    65,
+       59,    53,    99,    89,    66,    65,    64,   106,    57,    53,    76,    70,
+       63,    56,   102,    86,    69,    53,    19,    53,    27,    23,    53,    53,
+       47,    40,    17,    23,    29,    35,    41,    15,     0,     1,     2,     0,
+        0,    -7,   -15,     0,     0,     0,    -6,   -12,   -18,   -24,   -30,     0,
+        0,   -28,   -28,   -53,   -53,   -53,   -45,   -37,   -45,   -53,   -53,   -53,
+      -53,   -51,   -48,   -46,   -50,   -53,   -53,  -106,   -53,  -106,   -54,   -80,
+     -106,   -93,  -106,   -84,   -91,   -99,  -106,  -106,  -106,   -57,  -106,  -106,
+     -134,  -114,  -115,  -117,  -138,  -159,  -151,  -125,  -119,  -112,  -106,  -106,
+     -130,  -154,  -124,  -159,  -159,  -151,  -142,  -135,  -159,  -184,  -159,  -196,
+     -189,  -181,  -174,  -186,  -186,  -187,  -192,  -172,  -207,  -212,  -206,  -200,
+     -194,  -212,  -221,  -229,  -212,  -214,  -217,  -249,  -212,  -230,  -265,  -212,
+     -221,  -230,  -239,  -236,  -233,  -265,  -265,  -265,  -265,  -265,  -265,  -265,
+     -269,  -273,  -274,  -275,  -280,  -318,  -292,  -265,  -287,  -309,  -313,  -304,
+     -309,  -314,  -318,  -265,  -318,  -318,  -304,  -318,  -318,  -318,  -318,  -318,
+     -318,  -318,  -318,  -334,  -334,  -335,  -335,  -337,  -339,  -341,  -318,  -363,
+     -340,  -371,  -371,  -359,  -371,  -371,  -371,  -360,  -366,  -371,  -371,  -350,
+     -361,  -371,  -374,  -374,  -377,  -381,  -384,  -371,  -386,  -401,  -403,  -410,
+     -417,  -425,  -403,  -382,  -425,  -425,  -425,  -425,  -425,  -444,  -453,  -461,
+     -469,  -478,  -451,  -442,  -437,  -432,  -447,  -463,  -473,  -471,  -469,  -478,
+     -478,  -478,  -478,  -514,  -478,  -478,  -478,  -478,  -478,  -478,  -482,  -484,
+     -531,  -515,  -519,  -523,  -516,  -531,  -531,  -544,  -541,  -537,  -534,  -531,
+     -531,  -531,  -531,  -531,  -548,  -565,  -531,  -552,  -574,  -557,  -577,  -584,
+     -583,  -582,  -581,  -580,  -582,  -584,  -558,  -571,  -584,  -584,  -605,  -584,
+     -584,  -590,  -596,  -603,  -618,  -590,  -584,  -637,  -622,  -607,  -604,  -600,
+     -637,  -637,  -637,  -637,  -659,  -666,  -673,  -648,  -647,  -646,  -645,  -678,
+     -657,  -637,  -637,  -671,  -637,  -687,  -683,  -679,  -676,  -683,  -690,  -689,
+     -689,  -716,  -690,  -690,  -690,  -690,  -690,  -690,  -690,  -690,  -739,  -743,
+     -743,  -696,  -708,  -720,  -716,  -713,  -728,  -742,  -751,  -760,  -769,  -757,
+     -753,  -750,  -746,  -743,  -785,  -758,  -769,  -783,  -796,  -777,  -796,  -794,
+     -794,  -795,  -795,  -796,  -796,  -796,  -804,  -800,  -796,  -796,  -796,  -819,
+     -796,  -796,  -813,  -830,  -847,  -849,  -836,  -830,  -836,  -843,  -849,  -831,
+     -836,  -840,  -845,  -849,  -849,  -887,  -868,  -849,  -849,  -856,  -864,  -855,
+     -902,  -860,  -883,  -860,  -849,  -902,  -902,  -902,  -902,  -875,  -902,  -940,
+     -921,  -902,  -902,  -902,  -916,  -909,  -902,  -902,  -938,  -902,  -950,  -936,
+     -921,  -955,  -955,  -956,  -955,  -968,  -982,  -995, -1008,  -968, -1004,  -955,
+     -983,  -955,  -955,  -982,  -970,  -957,  -973, -1008, -1008, -1008, -1008, -1008,
+    -1008, -1008, -1008, -1007, -1006, -1008, -1008, -1008, -1008, -1008, -1008, -1032,
+    -1035, -1038, -1061, -1052, -1055, -1058, -1061, -1061, -1060, -1061, -1061, -1045,
+    -1061, -1061, -1061, -1100, -1091, -1083, -1061, -1063, -1062, -1061, -1077, -1092,
+    -1101, -1098, -1096, -1093, -1097, -1106, -1114, -1114, -1117, -1121, -1124, -1121,
+    -1117, -1114, -1114, -1128, -1137, -1167, -1133, -1167, -1164, -1161, -1167, -1146,
+    -1153, -1160, -1167, -1158, -1163, -1167, -1167, -1167, -1177, -1167, -1167, -1183,
+    -1199, -1215, -1167, -1194, -1198, -1203, -1207, -1214, -1221, -1221, -1181, -1176,
+    -1172, -1214, -1217, -1221, -1187, -1221, -1236, -1241, -1249, -1257, -1221, -1222,
+    -1223, -1221, -1274, -1274, -1258, -1273, -1247, -1274, -1291, -1308, -1277, -1274,
+    -1274, -1274, -1274, -1274, -1282, -1274, -1303, -1302, -1297, -1327, -1314, -1301,
+    -1304, -1308, -1327, -1314, -1325, -1318, -1312, -1305, -1327, -1327, -1327, -1327,
+    -1331, -1361, -1329, -1341, -1353, -1344, -1360, -1361, -1367, -1373, -1380, -1380,
+    -1380, -1380, -1380, -1380, -1380, -1380, -1335, -1403, -1380, -1380, -1402, -1424,
+    -1410, -1396, -1382, -1390, -1412, -1433, -1419, -1414, -1433, -1433, -1433, -1433,
+    -1433, -1433, -1433, -1433, -1433, -1433, -1443, -1454, -1437, -1454, -1469, -1468,
+    -1458, -1468, -1477, -1486, -1479, -1464, -1448, -1486, -1486, -1486, -1486, -1486,
+    -1486, -1486, -1489, -1503, -1507, -1539, -1516, -1490, -1503, -1534, -1539, -1539,
+    -1539, -1539, -1539, -1512, -1526, -1539, -1509, -1539, -1538, -1539, -1539, -1539,
+    -1539, -1539, -1562, -1561, -1550, -1539, -1539, -1569, -1588, -1582, -1576, -1584,
+    -1592, -1607, -1592, -1592, -1592, -1592, -1592, -1605, -1617, -1630, -1592, -1608,
+    -1645, -1645, -1645, -1647, -1648, -1648, -1649, -1650, -1650, -1651, -1651, -1652,
+    -1653, -1653, -1654, -1655, -1655, -1656, -1657, -1657, -1658, -1658, -1659, -1660,
+    -1660, -1661, -1698, -1698, -1684, -1670, -1680, -1689, -1698, -1673, -1662, -1680,
+    -1698, -1698, -1707, -1709, -1710, -1711, -1712, -1711, -1709, -1708, -1730, -1751,
+    -1751, -1751, -1745, -1739, -1744, -1748, -1751, -1751, -1751, -1751, -1763, -1775,
+    -1763, -1751, -1751, -1768, -1760, -1751, -1761, -1770, -1751, -1782, -1804, -1804,
+    -1797, -1789, -1797, -1804, -1804, -1804, -1804, -1804, -1804, -1804, -1796, -1803,
+    -1811, -1831, -1857, -1838, -1848, -1857, -1811, -1857, -1857, -1857, -1857, -1882,
+    -1842, -1850, -1857, -1857, -1857, -1857, -1857, -1865, -1861, -1857, -1875, -1893,
+    -1881, -1869, -1857, -1859, -1891, -1891, -1882, -1873, -1888, -1906, -1908, -1910,
+    -1910, -1910, -1910, -1910, -1915, -1920, -1925, -1928, -1936, -1950, -1963, -1961,
+    -1941, -1941, -1940, -1932, -1936, -1941, -1923, -1937, -1950, -1963, -1963, -1963,
+    -1969, -1975, -1981, -1990, -1999, -2000, -2007, -1963, -1970, -1977, -1996, -2014,
+    -2015, -2016, -2016, -2016, -2016, -1983, -2016, -2033, -2016, -2016, -2016, -2016,
+    -2016, -2055, -2068, -2042, -2033, -2025, -2016, -2016, -2036, -2027, -2025, -2051,
+    -2070, -2063, -2070, -2077, -2063, -2048, -2070, -2070, -2074, -2079, -2084, -2104,
+    -2123, -2123, -2113, -2103, -2113, -2123, -2120, -2117, -2108, -2099, -2123, -2123,
+    -2118, -2114, -2123, -2112, -2123, -2123, -2123, -2123, -2143, -2123, -2157, -2176,
+    -2153, -2165, -2176, -2176, -2176, -2176, -2176, -2142, -2176, -2176, -2176, -2176,
+    -2176, -2185, -2204, -2223, -2176, -2176, -2176, -2193, -2193, -2193, -2193, -2210,
+    -2228, -2228, -2229, -2225, -2221, -2225, -2229, -2227, -2226, -2273, -2229, -2248,
+    -2238, -2229, -2229, -2281, -2282, -2282, -2259, -2236, -2282, -2282, -2282, -2282,
+    -2282, -2282, -2282, -2282, -2282, -2282, -2282, -2282, -2282, -2282, -2282, -2316,
+    -2303, -2335, -2282, -2289, -2297, -2309, -2321, -2335, -2335, -2335, -2335, -2335,
+    -2328, -2321, -2347, -2335, -2335, -2335, -2335, -2379, -2367, -2354, -2354, -2367,
+    -2369, -2371, -2373, -2376, -2378, -2380, -2382, -2383, -2381, -2385, -2388, -2388,
+    -2388, -2403, -2418, -2408, -2398, -2388, -2389, -2391, -2411, -2430, -2439, -2409,
+    -2389, -2428, -2435, -2441, -2441, -2441, -2440, -2435, -2437, -2439, -2441, -2437,
+    -2439, -2440, -2441, -2441, -2445, -2443, -2441, -2459, -2453, -2448, -2443, -2489,
+    -2454, -2461, -2468, -2475, -2494, -2494, -2494, -2494, -2481, -2494, -2494, -2494,
+    -2494, -2494, -2472, -2494, -2494, -2494, -2494, -2494, -2500, -2506, -2505, -2519,
+    -2533, -2499, -2514, -2529, -2538, -2547, -2554, -2547, -2550, -2553, -2556, -2559,
+    -2547, -2547, -2547, -2547, -2547, -2591, -2596, -2568, -2582, -2595, -2600, -2547,
+    -2560, -2574, -2587, -2600, -2600, -2596, -2600, -2612, -2625, -2612, -2600, -2600,
+    -2626, -2608, -2600, -2653, -2627, -2600, -2621, -2643, -2633, -2624, -2631, -2638,
+    -2646, -2653, -2653, -2653, -2653, -2653, -2650, -2646, -2649, -2651, -2653, -2677,
+    -2688, -2700, -2658, -2676, -2694, -2706, -2692, -2678, -2688, -2698, -2706, -2706,
+    -2706, -2706, -2706, -2706, -2706, -2706, -2706, -2734, -2706, -2706, -2752, -2730,
+    -2724, -2706, -2711, -2716, -2721, -2725, -2728, -2730, -2736, -2742, -2751, -2759,
+    -2759, -2759, -2759, -2759, -2759, -2775, -2791, -2806, -2801, -2796, -2791, -2786,
+    -2777, -2768, -2759, -2786, -2812, -2806, -2799, -2788, -2812, -2812, -2812, -2803,
+    -2805, -2808, -2810, -2812, -2812, -2812, -2814, -2816, -2818, -2818, -2817, -2848,
+    -2852, -2857, -2861, -2866, -2866, -2866, -2866, -2842, -2854, -2866, -2866, -2866,
+    -2871, -2876, -2881, -2886, -2891, -2896, -2901, -2906, -2911, -2916, -2866, -2872,
+    -2878, -2866, -2892, -2890, -2901, -2866, -2902, -2872, -2886, -2901, -2896, -2892,
+    -2919, -2866, -2888, -2910, -2937, -2963, -2938, -2914, -2919, -2919, -2919, -2919,
+    -2922, -2925, -2929, -2932, -2925, -2919, -2924, -2919, -2919, -2965, -2960, -2955,
+    -2962, -2972, -2972, -2927, -2935, -2942, -2949, -2957, -2964, -2972, -2972, -2960,
+    -2964, -2968, -2972, -2984, -2977, -3000, -2972, -2998, -3003, -3009, -3014, -3022,
+    -3023, -3024, -3025, -3025, -3025, -3025, -3022, -3019, -3016, -3038, -3038, -3038,
+    -3037, -3025, -3051, -3025, -3025, -3025, -3025, -3032, -3028, -3025, -3044, -3049,
+    -3054, -3044, -3052, -3060, -3069, -3078, -3122, -3078, -3078, -3078, -3078, -3078,
+    -3078, -3078, -3078, -3092, -3091, -3131, -3120, -3110, -3095, -3080, -3103, -3127,
+    -3102, -3078, -3110, -3131, -3131, -3131, -3152, -3131, -3131, -3131, -3131, -3131,
+    -3131, -3131, -3131, -3131, -3131, -3131, -3162, -3169, -3175, -3182, -3175, -3169,
+    -3163, -3158, -3184, -3181, -3165, -3150, -3167, -3184, -3184, -3184, -3184, -3184,
+    -3184, -3184, -3184, -3184, -3184, -3184, -3184, -3184, -3197, -3210, -3224, -3235,
+    -3236, -3236, -3237, -3184, -3210, -3237, -3232, -3237, -3226, -3237, -3237, -3237,
+    -3237, -3237, -3237, -3237, -3237, -3237, -3249, -3260, -3256, -3252, -3237, -3262,
+    -3272, -3250, -3290, -3248, -3290, -3290, -3277, -3264, -3277, -3290, -3290, -3290,
+    -3290, -3290, -3290, -3290, -3290, -3290, -3290, -3290, -3290, -3290, -3290, -3301,
+    -3304, -3307, -3310, -3313, -3322, -3330, -3337, -3343, -3343, -3343, -3343, -3343,
+    -3343, -3343, -3343, -3343, -3343, -3344, -3344, -3344, -3343, -3392, -3368, -3343,
+    -3341, -3343, -3396, -3396, -3396, -3396, -3396, -3394, -3392, -3390, -3370, -3351,
+    -3374, -3396, -3396, -3396, -3396, -3396, -3378, -3396, -3396, -3396, -3396, -3396,
+    -3397, -3398, -3398, -3398, -3397, -3396, -3403, -3397, -3414, -3400, -3404, -3407,
+    -3411, -3414, -3405, -3396, -3416, -3435, -3439, -3442, -3449, -3439, -3448, -3458,
+    -3417, -3447, -3449, -3451, -3453, -3432, -3449, -3449, -3449, -3449, -3449, -3474,
+    -3461, -3449, -3461, -3449, -3468, -3477, -3486, -3495, -3502, -3476, -3449, -3502,
+    -3502, -3502, -3502, -3502, -3500, -3498, -3451, -3465, -3478, -3492, -3497, -3502,
+    -3555, -3502, -3510, -3518, -3526, -3534, -3507, -3524, -3525, -3526, -3502, -3517,
+    -3533, -3540, -3548, -3555, -3555, -3551, -3547, -3543, -3547, -3551, -3555, -3533,
+    -3544, -3555, -3555, -3555, -3555, -3555, -3555, -3555, -3555, -3555, -3555, -3608,
+    -3600, -3591, -3582, -3573, -3564, -3555, -3555, -3555, -3597, -3603, -3608, -3596,
+    -3602, -3608, -3581, -3555, -3582, -3608, -3608, -3608, -3608, -3608, -3608, -3608,
+    -3608, -3608, -3608, -3608, -3616, -3624, -3631, -3639, -3646, -3654, -3662, -3653,
+    -3645, -3642, -3640, -3608, -3637, -3662, -3649, -3649, -3649, -3649, -3649, -3645,
+    -3640, -3636, -3659, -3662, -3662, -3662, -3662, -3642, -3647, -3652, -3666, -3664,
+    -3663, -3662, -3662, -3662, -3662, -3662, -3662, -3662, -3662, -3662, -3662, -3678,
+    -3695, -3698, -3701, -3689, -3698, -3706, -3715, -3715, -3715, -3715, -3715, -3715,
+    -3715, -3715, -3715, -3734, -3753, -3715, -3723, -3723, -3724, -3724, -3724, -3736,
+    -3730, -3725, -3720, -3715, -3723, -3715, -3768, -3732, -3718, -3722, -3726, -3729,
+    -3715, -3732, -3750, -3768, -3767, -3766, -3766, -3767, -3767, -3768, -3768, -3768,
+    -3768, -3768, -3768, -3768, -3771, -3775, -3779, -3782, -3786, -3789, -3793, -3803,
+    -3795, -3787, -3801, -3803, -3805, -3796, -3786, -3777, -3768, -3785, -3821, -3791,
+    -3806, -3821, -3793, -3821, -3822, -3823, -3825, -3826, -3826, -3825, -3825, -3825,
+    -3824, -3824, -3824, -3823, -3823, -3823, -3822, -3822, -3822, -3821, -3821, -3821,
+    -3821, -3842, -3831, -3821, -3830, -3840, -3821, -3823, -3825, -3827, -3826, -3825,
+    -3841, -3857, -3874, -3871, -3867, -3859, -3874, -3874, -3874, -3874, -3874, -3874,
+    -3874, -3874, -3874, -3874, -3874, -3874, -3874, -3874, -3874, -3874, -3885, -3891,
+    -3893, -3895, -3916, -3878, -3885, -3892, -3899, -3906, -3913, -3920, -3874, -3874,
+    -3892, -3911, -3918, -3902, -3910, -3919, -3927, -3927, -3927, -3927, -3927, -3927,
+    -3927, -3927, -3927, -3938, -3949, -3941, -3933, -3937, -3935, -3932, -3929, -3927,
+    -3931, -3935, -3939, -3943, -3944, -3935, -3927, -3953, -3980, -3944, -3980, -3980,
+    -3980, -3971, -3962, -3953, -3945, -3936, -3927, -3949, -3971, -3971, -3970, -3970,
+    -3984, -3983, -3982, -3982, -3981, -3980, -3967, -3954, -3942, -3929, -3980, -3980,
+    -3980, -3980, -3980, -3980, -3980, -3980, -4016, -3980, -3998, -4015, -4033, -4017,
+    -4025, -4033, -4016, -3999, -4010, -4022, -4033, -4001, -4016, -4027, -4028, -4030,
+    -4031, -4033, -4033, -4033, -4033, -4033, -4033, -4033, -4033, -4033, -4033, -4033,
+    -4033, -4037, -4041, -4046, -4039, -4033, -4033, -4033, -4033, -4033, -4037, -4040,
+    -4044, -4048, -4035, -4046, -4057, -4069, -4064, -4059, -4064, -4068, -4073, -4077,
+    -4082, -4086, -4086, -4086, -4086, -4086, -4086, -4086, -4086, -4086, -4086, -4086,
+    -4086, -4066, -4086, -4086, -4086, -4086, -4086, -4086, -4086, -4126, -4106, -4086,
+    -4113, -4114, -4116, -4112, -4107, -4118, -4128, -4139, -4133, -4128, -4122, -4123,
+    -4105, -4139, -4139, -4139, -4139, -4139, -4139, -4139, -4139, -4139, -4139, -4139,
+    -4129, -4119, -4109, -4103, -4097, -4090, -4115, -4139, -4159, -4149, -4139, -4152,
+    -4139, -4142, -4144, -4147, -4149, -4152, -4154, -4157, -4190, -4158, -4161, -4164,
+    -4167, -4170, -4173, -4180, -4186, -4192, -4189, -4186, -4188, -4190, -4192, -4139,
+    -4157, -4174, -4192, -4194, -4195, -4194, -4192, -4192, -4192, -4192, -4192, -4192,
+    -4192, -4192, -4202, -4211, -4221, -4230, -4245, -4178, -4185, -4192, -4192, -4192,
+    -4219, -4245, -4245, -4245, -4245, -4216, -4228, -4220, -4213, -4205, -4226, -4225,
+    -4224, -4245, -4228, -4237, -4245, -4245, -4245, -4245, -4245, -4245, -4245, -4245,
+    -4192, -4210, -4228, -4245, -4245, -4245, -4245, -4245, -4245, -4245, -4245, -4245,
+    -4245, -4245, -4245, -4245, -4245, -4245, -4245, -4256, -4267, -4245, -4264, -4283,
+    -4278, -4273, -4268, -4262, -4279, -4296, -4296, -4295, -4295, -4294, -4295, -4296,
+    -4297, -4298, -4264, -4273, -4281, -4290, -4298, -4298, -4298, -4298, -4298, -4298,
+    -4298, -4298, -4303, -4308, -4298, -4298, -4298, -4320, -4298, -4298, -4298, -4303,
+    -4308, -4314, -4319, -4324, -4322, -4320, -4318, -4325, -4318, -4312, -4305, -4298,
+    -4298, -4316, -4334, -4351, -4346, -4341, -4335, -4341, -4346, -4351, -4349, -4347,
+    -4345, -4344, -4343, -4345, -4347, -4349, -4351, -4351, -4351, -4351, -4351, -4351,
+    -4351, -4351, -4351, -4351, -4357, -4363, -4376, -4389, -4370, -4351, -4351, -4356,
+    -4360, -4364, -4368, -4368, -4367, -4366, -4362, -4358, -4395, -4397, -4398, -4399,
+    -4401, -4402, -4377, -4351, -4369, -4387, -4404, -4373, -4370, -4368, -4386, -4404,
+    -4404, -4404, -4404, -4404, -4404, -4404, -4404, -4404, -4404, -4404, -4404, -4404,
+    -4404, -4404, -4413, -4421, -4430, -4421, -4413, -4404, -4404, -4404, -4404, -4421,
+    -4438, -4455, -4456, -4457, -4449, -4441, -4432, -4457, -4443, -4419, -4422, -4425,
+    -4427, -4429, -4431, -4433, -4441, -4449, -4457, -4448, -4439, -4430, -4421, -4444,
+    -4466, -4463, -4460, -4457, -4457, -4457, -4457, -4457, -4472, -4487, -4502, -4457,
+    -4457, -4457, -4627, -4796 };
+
+
+// nominal attenuation of each range against 12 dB (1, 1.33, 2 and 3.98 x the 0 dB
+// input span) until the ranges get tables of their own
+const adc_range_cal_t ADC_RANGES[ADC_NUM_RANGES] = {
+    { ADC_LUT_MV, 16468 },                  // 0 dB
+    { ADC_LUT_MV, 21901 },                  // 2.5 dB
+    { ADC_LUT_MV, 32931 },                  // 6 dB
+    { ADC_LUT_MV, ADC_RANGE_SCALE_ONE },    // 12 dB, measured
+};
@@ -1,5 +1,45 @@
 #pragma once
 #include <stdint.h>
 
-// Lookup table mapping ADC readings (0-4095) to readable voltages (-5V to +5V)
-extern const float ADC_LUT[4096];
+// Lookup table mapping ADC readings (0-4095) to input millivolts (-5000 to +5000),
+// measured with the input at 12 dB attenuation. 1 mV steps are finer than a code
+// (about 2.4 mV at 12 dB), and int16 keeps the table at 8 KB with no float math on the way.
+// tools/lut_gen.py refits it from adc_logger captures
+extern const int16_t ADC_LUT_MV[4096];
+
+// input ranges, one per ADC attenuation in adc_atten_t order (0, 2.5, 6, 12 dB).
+// the lower attenuations see a narrower slice of the front end's output in more codes
+#define ADC_NUM_RANGES      4
+#define ADC_RANGE_12DB      3   // full +-5V input
+#define ADC_RANGE_SCALE_ONE (1u << 16)
+
+// calibration of one range: the table that turns its codes into volts and where its
+// codes land on that table. a range measured on its own gets its own table and
+// code_scale == ADC_RANGE_SCALE_ONE, the others borrow the 12 dB table through the
+// nominal attenuation ratio
+typedef struct {
+    const int16_t *lut;     // mV
+    uint32_t code_scale;    // Q16: range code -> table code
+} adc_range_cal_t;
+
+extern const adc_range_cal_t ADC_RANGES[ADC_NUM_RANGES];
+
+// millivolts of a sample in the given range carrying frac_bits extra bits below the 12 bit
+// code (hi-res), interpolated between neighbouring table entries instead of truncating
+// and rounded to the nearest mV
+static inline int32_t adc_lut_mv(int range, uint32_t sample, int frac_bits)
+{
+    const adc_range_cal_t *cal = &ADC_RANGES[range];
+    if (cal->code_scale != ADC_RANGE_SCALE_ONE) { sample = (sample * cal->code_scale) >> 16;}
+    uint32_t code = sample >> frac_bits;
+    if (code >= 4095) { return cal->lut[4095];}
+    int32_t step = (cal->lut[code + 1] - cal->lut[code]) * (int32_t)(sample & ((1u << frac_bits) - 1));
+    return cal->lut[code] + ((step + ((1 << frac_bits) >> 1)) >> frac_bits);
+}
+
+// sample of the given range as a 12 dB code with the same frac_bits, for drawing every
+// range on the same volts per division
+static inline uint32_t adc_range_to_ref(int range, uint32_t sample)
+{
+    return (sample * ADC_RANGES[range].code_scale) >> 16;
+}
@@ -0,0 +1,459 @@
+// the float volts table LUT.c held before it went to int16 mV, kept as the reference
+// test_lut_mv checks the int16 path against
+const float ADC_LUT_V_REF[4096] = {
+    4.967602f,  4.891640f,  4.815678f,  4.817757f,  4.819835f,  4.821914f,  4.823992f,  4.826822f,  4.801351f,
+    4.775879f,  4.828945f,  4.782247f,  4.775879f,  4.781775f,  4.787672f,  4.793568f,  4.788084f,  4.781982f,
+    4.775879f,  4.775879f,  4.780125f,  4.784370f,  4.775879f,  4.775879f,  4.775879f,  4.775879f,  4.763144f,
+    4.769512f,  4.775879f,  4.762613f,  4.749347f,  4.775879f,  4.775879f,  4.749347f,  4.722814f,  4.774818f,
+    4.739795f,  4.733427f,  4.727059f,  4.724937f,  4.722814f,  4.722814f,  4.722814f,  4.730774f,  4.678239f,
+    4.693097f,  4.707956f,  4.722814f,  4.714058f,  4.718436f,  4.722814f,  4.696281f,  4.694513f,  4.692744f,
+    4.690975f,  4.710078f,  4.689914f,  4.669749f,  4.669749f,  4.669749f,  4.670810f,  4.671871f,  4.672933f,
+    4.669749f,  4.656482f,  4.669749f,  4.645339f,  4.653475f,  4.661612f,  4.669749f,  4.669749f,  4.644277f,
+    4.644041f,  4.643806f,  4.643570f,  4.630127f,  4.616683f,  4.623051f,  4.669749f,  4.646703f,  4.623658f,
+    4.616683f,  4.616683f,  4.616683f,  4.616683f,  4.616683f,  4.616683f,  4.602886f,  4.607485f,  4.612084f,
+    4.616683f,  4.616683f,  4.616683f,  4.603152f,  4.589620f,  4.578476f,  4.597580f,  4.616683f,  4.563618f,
+    4.563618f,  4.589089f,  4.563618f,  4.563618f,  4.608193f,  4.585905f,  4.563618f,  4.553005f,  4.558312f,
+    4.563618f,  4.563618f,  4.547345f,  4.544161f,  4.540977f,  4.536908f,  4.532840f,  4.540800f,  4.548760f,
+    4.534432f,  4.526472f,  4.518513f,  4.510553f,  4.519043f,  4.527534f,  4.510553f,  4.510553f,  4.510553f,
+    4.510553f,  4.505246f,  4.499940f,  4.510553f,  4.493572f,  4.494633f,  4.484551f,  4.474468f,  4.484020f,
+    4.482959f,  4.481897f,  4.480836f,  4.457487f,  4.476591f,  4.470223f,  4.463855f,  4.457487f,  4.508430f,
+    4.469516f,  4.463501f,  4.457487f,  4.457487f,  4.457487f,  4.457487f,  4.457487f,  4.457487f,  4.456780f,
+    4.456072f,  4.455365f,  4.457487f,  4.430955f,  4.404422f,  4.450058f,  4.427240f,  4.404422f,  4.419280f,
+    4.436261f,  4.412913f,  4.442629f,  4.430955f,  4.404422f,  4.404422f,  4.404422f,  4.404422f,  4.404422f,
+    4.402830f,  4.401238f,  4.404422f,  4.401710f,  4.398998f,  4.396285f,  4.360909f,  4.391686f,  4.390625f,
+    4.389564f,  4.392748f,  4.368338f,  4.351357f,  4.351357f,  4.351357f,  4.351357f,  4.351357f,  4.351357f,
+    4.351357f,  4.351357f,  4.351357f,  4.304659f,  4.351357f,  4.308904f,  4.385319f,  4.332253f,  4.351357f,
+    4.333315f,  4.333668f,  4.334022f,  4.334376f,  4.329423f,  4.325532f,  4.321640f,  4.317395f,  4.313150f,
+    4.306782f,  4.288527f,  4.281311f,  4.289801f,  4.298291f,  4.294754f,  4.291216f,  4.298291f,  4.279188f,
+    4.288740f,  4.298291f,  4.265391f,  4.296169f,  4.245226f,  4.245226f,  4.245226f,  4.257962f,  4.245226f,
+    4.245226f,  4.245226f,  4.209142f,  4.245226f,  4.234613f,  4.219755f,  4.247349f,  4.259554f,  4.271759f,
+    4.231783f,  4.245226f,  4.226653f,  4.208080f,  4.210274f,  4.212467f,  4.214660f,  4.192161f,  4.192161f,
+    4.228245f,  4.229306f,  4.230368f,  4.192161f,  4.192161f,  4.192161f,  4.192161f,  4.192161f,  4.192161f,
+    4.192161f,  4.208080f,  4.147586f,  4.192161f,  4.207019f,  4.184201f,  4.175313f,  4.166424f,  4.157536f,
+    4.148647f,  4.141218f,  4.170935f,  4.181017f,  4.191099f,  4.173765f,  4.156430f,  4.139095f,  4.139095f,
+    4.139095f,  4.139095f,  4.147161f,  4.124237f,  4.139095f,  4.139095f,  4.086030f,  4.112563f,  4.139095f,
+    4.122115f,  4.129013f,  4.135912f,  4.119992f,  4.121053f,  4.122115f,  4.123176f,  4.113624f,  4.086030f,
+    4.086030f,  4.086030f,  4.098766f,  4.094521f,  4.090275f,  4.086030f,  4.086030f,  4.064804f,  4.086030f,
+    4.086030f,  4.082846f,  4.079662f,  4.086030f,  4.077540f,  4.081785f,  4.086030f,  4.079662f,  4.048531f,
+    4.032965f,  4.059497f,  4.062681f,  4.032965f,  4.032965f,  4.032965f,  4.032965f,  4.032965f,  4.032965f,
+    4.032965f,  4.032965f,  4.032965f,  4.036502f,  4.034734f,  4.032965f,  4.032965f,  4.032965f,  3.988390f,
+    3.994404f,  4.000418f,  4.006432f,  3.989451f,  3.986267f,  3.983083f,  3.979899f,  3.994758f,  3.979899f,
+    4.015276f,  3.998649f,  3.982022f,  3.983083f,  3.979899f,  3.979899f,  3.979899f,  3.926834f,  3.979899f,
+    3.979899f,  3.979899f,  3.979899f,  3.966102f,  3.952305f,  3.975654f,  3.956551f,  3.937447f,  3.935325f,
+    3.926834f,  3.930018f,  3.926834f,  3.926834f,  3.926834f,  3.926834f,  3.926834f,  3.926834f,  3.926834f,
+    3.926834f,  3.926834f,  3.926834f,  3.907731f,  3.888627f,  3.911976f,  3.926834f,  3.926834f,  3.896269f,
+    3.873769f,  3.926834f,  3.873769f,  3.883851f,  3.893934f,  3.868816f,  3.866929f,  3.865043f,  3.863156f,
+    3.853604f,  3.873769f,  3.873769f,  3.873769f,  3.873769f,  3.858911f,  3.847236f,  3.833439f,  3.820703f,
+    3.827071f,  3.826010f,  3.824949f,  3.836092f,  3.847236f,  3.833970f,  3.820703f,  3.820703f,  3.820703f,
+    3.820703f,  3.820703f,  3.820703f,  3.820703f,  3.822402f,  3.820703f,  3.778251f,  3.820703f,  3.820703f,
+    3.802661f,  3.812213f,  3.767638f,  3.771353f,  3.775067f,  3.774006f,  3.772355f,  3.770704f,  3.769053f,
+    3.784619f,  3.776129f,  3.767638f,  3.780374f,  3.767638f,  3.767638f,  3.757556f,  3.747473f,  3.767638f,
+    3.767638f,  3.767638f,  3.767638f,  3.767638f,  3.729431f,  3.767638f,  3.749596f,  3.761270f,  3.749596f,
+    3.737922f,  3.718818f,  3.714573f,  3.714573f,  3.714573f,  3.714573f,  3.741105f,  3.714573f,  3.722002f,
+    3.705552f,  3.689101f,  3.689101f,  3.701837f,  3.714573f,  3.714573f,  3.712450f,  3.710328f,  3.688040f,
+    3.696884f,  3.679196f,  3.661507f,  3.661507f,  3.661507f,  3.671059f,  3.666283f,  3.661507f,  3.661507f,
+    3.661507f,  3.661507f,  3.661507f,  3.661507f,  3.661507f,  3.655989f,  3.632852f,  3.661507f,  3.627546f,
+    3.638159f,  3.623300f,  3.608442f,  3.608442f,  3.608442f,  3.608442f,  3.608442f,  3.635329f,  3.621885f,
+    3.608442f,  3.608442f,  3.608442f,  3.608442f,  3.608442f,  3.608442f,  3.604904f,  3.600305f,  3.595706f,
+    3.582440f,  3.569174f,  3.573419f,  3.577664f,  3.581910f,  3.555377f,  3.578726f,  3.602074f,  3.563867f,
+    3.608442f,  3.548160f,  3.572358f,  3.555377f,  3.586155f,  3.570766f,  3.555377f,  3.555377f,  3.528844f,
+    3.502312f,  3.535212f,  3.529905f,  3.523184f,  3.516462f,  3.509741f,  3.542641f,  3.506557f,  3.508414f,
+    3.510271f,  3.512129f,  3.513986f,  3.515843f,  3.517700f,  3.519558f,  3.521415f,  3.523272f,  3.525130f,
+    3.526987f,  3.528844f,  3.502312f,  3.502312f,  3.502312f,  3.502312f,  3.498420f,  3.500366f,  3.502312f,
+    3.502312f,  3.475779f,  3.502312f,  3.496474f,  3.490637f,  3.484800f,  3.478963f,  3.463043f,  3.465873f,
+    3.468703f,  3.471534f,  3.502312f,  3.484623f,  3.466935f,  3.449246f,  3.449246f,  3.449246f,  3.449246f,
+    3.449246f,  3.449246f,  3.442878f,  3.436511f,  3.430143f,  3.449246f,  3.446062f,  3.442878f,  3.449246f,
+    3.422714f,  3.396181f,  3.413162f,  3.418468f,  3.411570f,  3.404671f,  3.401841f,  3.399011f,  3.396181f,
+    3.390521f,  3.384860f,  3.379200f,  3.387160f,  3.395120f,  3.396181f,  3.396181f,  3.343116f,  3.343116f,
+    3.365191f,  3.383445f,  3.396181f,  3.371771f,  3.343116f,  3.356382f,  3.369648f,  3.343116f,  3.343116f,
+    3.343116f,  3.343116f,  3.343116f,  3.343116f,  3.343116f,  3.343116f,  3.319767f,  3.343116f,  3.316583f,
+    3.290050f,  3.343116f,  3.322951f,  3.302786f,  3.338870f,  3.327196f,  3.314814f,  3.302432f,  3.290050f,
+    3.290050f,  3.290050f,  3.316583f,  3.290050f,  3.290050f,  3.290050f,  3.290050f,  3.294030f,  3.298010f,
+    3.295357f,  3.292703f,  3.290050f,  3.290050f,  3.290050f,  3.290050f,  3.236985f,  3.290050f,  3.264579f,
+    3.288989f,  3.257150f,  3.250706f,  3.244262f,  3.236985f,  3.236985f,  3.236985f,  3.236985f,  3.236985f,
+    3.236985f,  3.236985f,  3.224249f,  3.211514f,  3.236985f,  3.228494f,  3.236985f,  3.222127f,  3.213636f,
+    3.205146f,  3.196655f,  3.204084f,  3.183920f,  3.236985f,  3.183920f,  3.183920f,  3.183920f,  3.183920f,
+    3.183920f,  3.183920f,  3.183920f,  3.166939f,  3.175429f,  3.183920f,  3.183920f,  3.177552f,  3.166939f,
+    3.183920f,  3.130854f,  3.136161f,  3.154203f,  3.130854f,  3.152788f,  3.174722f,  3.152788f,  3.130854f,
+    3.130854f,  3.132977f,  3.154203f,  3.130854f,  3.124133f,  3.117411f,  3.115642f,  3.113873f,  3.106444f,
+    3.124486f,  3.130854f,  3.130324f,  3.129793f,  3.112458f,  3.095124f,  3.077789f,  3.104322f,  3.109628f,
+    3.103260f,  3.094770f,  3.086279f,  3.077789f,  3.094239f,  3.077789f,  3.064523f,  3.051256f,  3.077789f,
+    3.077789f,  3.077789f,  3.077789f,  3.064523f,  3.051256f,  3.026846f,  3.052318f,  3.077789f,  3.062400f,
+    3.047011f,  3.043827f,  3.050902f,  3.075666f,  3.050195f,  3.024724f,  3.037459f,  3.077789f,  3.024724f,
+    3.024724f,  3.036929f,  3.049134f,  3.024724f,  3.024724f,  3.024724f,  3.024724f,  3.024724f,  3.024724f,
+    3.003497f,  2.983333f,  2.986517f,  2.981564f,  2.976611f,  2.971658f,  2.986517f,  2.991823f,  2.991823f,
+    2.991823f,  2.991823f,  2.971658f,  2.956800f,  2.971658f,  2.969536f,  2.967413f,  2.965290f,  2.971658f,
+    2.947248f,  2.971658f,  2.971658f,  2.971658f,  2.971658f,  2.939819f,  2.955739f,  2.971658f,  2.943357f,
+    2.936753f,  2.930149f,  2.923546f,  2.918593f,  2.918593f,  2.918593f,  2.918593f,  2.918593f,  2.918593f,
+    2.907449f,  2.896305f,  2.905327f,  2.914348f,  2.912756f,  2.911164f,  2.888169f,  2.894890f,  2.901612f,
+    2.902143f,  2.902673f,  2.910102f,  2.865528f,  2.865528f,  2.865528f,  2.837934f,  2.844832f,  2.851731f,
+    2.879855f,  2.907980f,  2.886754f,  2.865528f,  2.865528f,  2.864466f,  2.863405f,  2.865528f,  2.857037f,
+    2.848547f,  2.836519f,  2.848547f,  2.822368f,  2.817415f,  2.812462f,  2.823075f,  2.812462f,  2.812462f,
+    2.799727f,  2.786991f,  2.812462f,  2.812462f,  2.812462f,  2.812462f,  2.799727f,  2.786991f,  2.812462f,
+    2.812462f,  2.812462f,  2.812462f,  2.793359f,  2.776378f,  2.786460f,  2.796543f,  2.801319f,  2.806094f,
+    2.759397f,  2.759397f,  2.765057f,  2.770718f,  2.776378f,  2.759397f,  2.766371f,  2.759397f,  2.759397f,
+    2.744539f,  2.729680f,  2.742416f,  2.759397f,  2.756478f,  2.753560f,  2.750641f,  2.747723f,  2.759397f,
+    2.723313f,  2.728088f,  2.732864f,  2.727558f,  2.706332f,  2.732864f,  2.724197f,  2.715530f,  2.706332f,
+    2.706332f,  2.706332f,  2.699964f,  2.707039f,  2.714115f,  2.721190f,  2.706332f,  2.706332f,  2.706332f,
+    2.680330f,  2.654328f,  2.676969f,  2.656450f,  2.685106f,  2.672370f,  2.659634f,  2.675554f,  2.653266f,
+    2.610814f,  2.624965f,  2.639116f,  2.653266f,  2.640531f,  2.653266f,  2.653266f,  2.653266f,  2.644776f,
+    2.649021f,  2.653266f,  2.644776f,  2.602324f,  2.624611f,  2.604446f,  2.606569f,  2.626734f,  2.613467f,
+    2.600201f,  2.603385f,  2.606569f,  2.618243f,  2.610814f,  2.600201f,  2.600201f,  2.600201f,  2.595248f,
+    2.597725f,  2.600201f,  2.600201f,  2.600201f,  2.600201f,  2.585343f,  2.570484f,  2.555626f,  2.576852f,
+    2.589588f,  2.577914f,  2.566239f,  2.600201f,  2.580390f,  2.547136f,  2.568362f,  2.542890f,  2.508929f,
+    2.528032f,  2.547136f,  2.570484f,  2.540768f,  2.543952f,  2.547136f,  2.506806f,  2.519542f,  2.528563f,
+    2.537584f,  2.546605f,  2.539353f,  2.515296f,  2.513174f,  2.547136f,  2.547136f,  2.494070f,  2.494070f,
+    2.494070f,  2.494070f,  2.494070f,  2.494070f,  2.494070f,  2.494070f,  2.494070f,  2.494070f,  2.494070f,
+    2.481335f,  2.468599f,  2.483457f,  2.474967f,  2.494070f,  2.491948f,  2.492478f,  2.493009f,  2.493540f,
+    2.494070f,  2.456925f,  2.451618f,  2.460816f,  2.470014f,  2.462939f,  2.455863f,  2.449495f,  2.435168f,
+    2.441005f,  2.441005f,  2.441005f,  2.441005f,  2.441005f,  2.441005f,  2.441005f,  2.387940f,  2.391194f,
+    2.394449f,  2.397704f,  2.400958f,  2.404213f,  2.387940f,  2.389001f,  2.387940f,  2.403859f,  2.395899f,
+    2.387940f,  2.343365f,  2.387940f,  2.387940f,  2.387940f,  2.387940f,  2.387940f,  2.387940f,  2.387940f,
+    2.387940f,  2.368836f,  2.364591f,  2.366926f,  2.369261f,  2.351855f,  2.364591f,  2.353978f,  2.334874f,
+    2.334874f,  2.334874f,  2.334874f,  2.334874f,  2.334874f,  2.334874f,  2.334874f,  2.334874f,  2.334874f,
+    2.334874f,  2.334874f,  2.322139f,  2.334874f,  2.334874f,  2.326030f,  2.317186f,  2.308342f,  2.327445f,
+    2.281809f,  2.307280f,  2.332752f,  2.313648f,  2.334874f,  2.334874f,  2.281809f,  2.281809f,  2.282340f,
+    2.282870f,  2.281809f,  2.281809f,  2.281809f,  2.281809f,  2.281809f,  2.281809f,  2.274380f,  2.278094f,
+    2.281809f,  2.261114f,  2.240418f,  2.240949f,  2.241479f,  2.281809f,  2.243248f,  2.241286f,  2.239325f,
+    2.237363f,  2.235401f,  2.233439f,  2.231477f,  2.229516f,  2.227554f,  2.225592f,  2.223630f,  2.221668f,
+    2.228744f,  2.228744f,  2.228744f,  2.228744f,  2.228744f,  2.224498f,  2.254215f,  2.228213f,  2.202211f,
+    2.215477f,  2.228744f,  2.209640f,  2.190537f,  2.187942f,  2.185348f,  2.182754f,  2.190537f,  2.191598f,
+    2.192659f,  2.184169f,  2.175678f,  2.212824f,  2.194251f,  2.175678f,  2.145962f,  2.175678f,  2.175678f,
+    2.175678f,  2.168249f,  2.175678f,  2.173556f,  2.168249f,  2.162943f,  2.149146f,  2.154983f,  2.160820f,
+    2.122613f,  2.137471f,  2.130042f,  2.122613f,  2.122613f,  2.122613f,  2.122613f,  2.122613f,  2.122613f,
+    2.122613f,  2.122613f,  2.115538f,  2.108462f,  2.101387f,  2.114123f,  2.120490f,  2.113486f,  2.106481f,
+    2.082283f,  2.083345f,  2.084406f,  2.082283f,  2.080161f,  2.078038f,  2.074854f,  2.072201f,  2.069548f,
+    2.069548f,  2.069548f,  2.069548f,  2.069548f,  2.069548f,  2.069548f,  2.047048f,  2.051506f,  2.029218f,
+    2.018605f,  2.044076f,  2.069548f,  2.057873f,  2.029926f,  2.028275f,  2.026624f,  2.024973f,  2.030279f,
+    2.035586f,  2.040892f,  2.016482f,  2.016482f,  2.016482f,  2.016482f,  2.016482f,  2.016482f,  1.993134f,
+    1.987827f,  1.982521f,  2.012237f,  2.014360f,  2.016482f,  1.998794f,  2.016482f,  1.988888f,  1.998971f,
+    2.009053f,  1.982521f,  1.963417f,  1.963417f,  1.965540f,  1.963417f,  1.971908f,  1.980398f,  1.963417f,
+    1.963417f,  1.959526f,  1.955634f,  1.951743f,  1.963417f,  1.944314f,  1.953865f,  1.963417f,  1.958747f,
+    1.954078f,  1.950681f,  1.929455f,  1.944314f,  1.927333f,  1.910352f,  1.910352f,  1.910352f,  1.910352f,
+    1.910352f,  1.910352f,  1.910352f,  1.954927f,  1.863654f,  1.910352f,  1.894963f,  1.879574f,  1.905045f,
+    1.903453f,  1.901861f,  1.899208f,  1.896555f,  1.884880f,  1.895493f,  1.857286f,  1.857286f,  1.857286f,
+    1.877451f,  1.883288f,  1.889126f,  1.865777f,  1.867899f,  1.838183f,  1.857286f,  1.857286f,  1.857286f,
+    1.850919f,  1.857286f,  1.834999f,  1.812712f,  1.821733f,  1.830754f,  1.821202f,  1.811650f,  1.838183f,
+    1.855164f,  1.848796f,  1.842428f,  1.814834f,  1.791485f,  1.804221f,  1.772382f,  1.798915f,  1.801568f,
+    1.804221f,  1.805636f,  1.772382f,  1.784056f,  1.795731f,  1.804221f,  1.795377f,  1.786533f,  1.782111f,
+    1.777688f,  1.804221f,  1.780872f,  1.768137f,  1.751156f,  1.751156f,  1.751156f,  1.751156f,  1.751156f,
+    1.751156f,  1.751156f,  1.763184f,  1.775212f,  1.787240f,  1.751156f,  1.751156f,  1.774505f,  1.743196f,
+    1.742665f,  1.744788f,  1.732052f,  1.698090f,  1.740543f,  1.720024f,  1.721675f,  1.723326f,  1.724977f,
+    1.711534f,  1.698090f,  1.736297f,  1.717194f,  1.698090f,  1.708703f,  1.703397f,  1.698090f,  1.698090f,
+    1.698090f,  1.678987f,  1.698090f,  1.671558f,  1.672619f,  1.674742f,  1.676864f,  1.689600f,  1.682171f,
+    1.674742f,  1.676157f,  1.667619f,  1.659082f,  1.650544f,  1.645025f,  1.645025f,  1.645025f,  1.659883f,
+    1.604695f,  1.632289f,  1.602573f,  1.621676f,  1.640780f,  1.645025f,  1.645025f,  1.639719f,  1.634412f,
+    1.629106f,  1.617431f,  1.615309f,  1.595497f,  1.600096f,  1.604695f,  1.598328f,  1.591960f,  1.591960f,
+    1.591960f,  1.591960f,  1.591960f,  1.591960f,  1.591960f,  1.591960f,  1.591960f,  1.591960f,  1.591960f,
+    1.571583f,  1.591960f,  1.571441f,  1.578281f,  1.585120f,  1.591960f,  1.538894f,  1.581347f,  1.571205f,
+    1.561064f,  1.550923f,  1.547385f,  1.543140f,  1.538894f,  1.538894f,  1.538894f,  1.538894f,  1.538894f,
+    1.528281f,  1.538894f,  1.538894f,  1.538894f,  1.494320f,  1.538894f,  1.538894f,  1.538894f,  1.538894f,
+    1.512362f,  1.508117f,  1.503871f,  1.499626f,  1.493789f,  1.487952f,  1.485829f,  1.485829f,  1.485829f,
+    1.485829f,  1.485829f,  1.485829f,  1.485829f,  1.477339f,  1.468848f,  1.460358f,  1.485829f,  1.477339f,
+    1.468848f,  1.461419f,  1.453990f,  1.448683f,  1.432764f,  1.432764f,  1.432764f,  1.432764f,  1.432764f,
+    1.432764f,  1.432764f,  1.432764f,  1.432764f,  1.432764f,  1.420028f,  1.432764f,  1.427103f,  1.421443f,
+    1.415783f,  1.420559f,  1.403047f,  1.412599f,  1.422151f,  1.386066f,  1.418967f,  1.399333f,  1.379698f,
+    1.379698f,  1.379698f,  1.379698f,  1.379698f,  1.379698f,  1.379698f,  1.379698f,  1.379698f,  1.353166f,
+    1.379698f,  1.379698f,  1.379698f,  1.353166f,  1.348921f,  1.375453f,  1.367317f,  1.359180f,  1.351043f,
+    1.342907f,  1.326633f,  1.326633f,  1.330348f,  1.334062f,  1.326633f,  1.328048f,  1.322919f,  1.326633f,
+    1.313367f,  1.300100f,  1.326633f,  1.273568f,  1.326633f,  1.325572f,  1.324511f,  1.326633f,  1.326633f,
+    1.326633f,  1.273568f,  1.288426f,  1.273568f,  1.273568f,  1.273568f,  1.273568f,  1.273568f,  1.273568f,
+    1.273568f,  1.273568f,  1.273568f,  1.273568f,  1.273568f,  1.273568f,  1.273568f,  1.233238f,  1.273568f,
+    1.270384f,  1.267200f,  1.261893f,  1.220503f,  1.220503f,  1.220503f,  1.231116f,  1.241729f,  1.223686f,
+    1.220503f,  1.235361f,  1.250219f,  1.235361f,  1.220503f,  1.269323f,  1.220503f,  1.220503f,  1.220503f,
+    1.190786f,  1.220503f,  1.220503f,  1.220503f,  1.193970f,  1.167437f,  1.193970f,  1.203522f,  1.218380f,
+    1.167437f,  1.209889f,  1.201399f,  1.176989f,  1.195562f,  1.214135f,  1.191241f,  1.168347f,  1.167437f,
+    1.167437f,  1.158593f,  1.149749f,  1.140905f,  1.155763f,  1.153286f,  1.150810f,  1.148334f,  1.114372f,
+    1.167437f,  1.149395f,  1.131353f,  1.154701f,  1.119678f,  1.114372f,  1.114372f,  1.114372f,  1.121447f,
+    1.119089f,  1.116730f,  1.114372f,  1.109065f,  1.114372f,  1.114372f,  1.114372f,  1.114372f,  1.108004f,
+    1.101636f,  1.087839f,  1.114372f,  1.085717f,  1.073512f,  1.061307f,  1.072627f,  1.069089f,  1.065552f,
+    1.071389f,  1.077226f,  1.069266f,  1.061307f,  1.061307f,  1.061307f,  1.061307f,  1.061307f,  1.058653f,
+    1.059184f,  1.057061f,  1.054939f,  1.042203f,  1.030882f,  1.019562f,  1.008241f,  1.020977f,  1.020977f,
+    1.020977f,  1.020977f,  1.008241f,  1.016024f,  1.023807f,  1.031590f,  1.039373f,  1.008241f,  1.008241f,
+    1.003288f,  0.998336f,  0.993383f,  0.984539f,  0.975694f,  0.991968f,  1.008241f,  1.004350f,  1.000458f,
+    0.996567f,  0.972687f,  0.964993f,  0.957298f,  0.955902f,  0.954506f,  0.953647f,  0.952789f,  0.951930f,
+    0.951072f,  0.950213f,  0.949355f,  0.948496f,  0.947638f,  0.946779f,  0.945921f,  0.945063f,  0.944204f,
+    0.943346f,  0.942487f,  0.941629f,  0.940770f,  0.939912f,  0.939053f,  0.938195f,  0.902111f,  0.933950f,
+    0.944563f,  0.955176f,  0.898573f,  0.908832f,  0.919091f,  0.876639f,  0.889375f,  0.902111f,  0.902111f,
+    0.902111f,  0.902111f,  0.902111f,  0.902111f,  0.902111f,  0.902111f,  0.902111f,  0.888844f,  0.875578f,
+    0.888844f,  0.902111f,  0.874517f,  0.872394f,  0.879823f,  0.887252f,  0.881415f,  0.875578f,  0.858243f,
+    0.842677f,  0.845861f,  0.849045f,  0.849045f,  0.849045f,  0.849045f,  0.849045f,  0.849045f,  0.845861f,
+    0.842677f,  0.839493f,  0.849045f,  0.849045f,  0.801286f,  0.806062f,  0.810838f,  0.814376f,  0.795980f,
+    0.812961f,  0.807300f,  0.801640f,  0.795980f,  0.768386f,  0.767678f,  0.766971f,  0.766263f,  0.810838f,
+    0.784306f,  0.795980f,  0.795980f,  0.769447f,  0.742915f,  0.782714f,  0.743976f,  0.764141f,  0.753528f,
+    0.742915f,  0.742915f,  0.742915f,  0.742915f,  0.742915f,  0.742915f,  0.742915f,  0.742915f,  0.742915f,
+    0.742915f,  0.742915f,  0.719566f,  0.721688f,  0.718858f,  0.716028f,  0.742915f,  0.741853f,  0.740792f,
+    0.689849f,  0.707538f,  0.725226f,  0.742915f,  0.691972f,  0.689849f,  0.689849f,  0.728056f,  0.716382f,
+    0.715321f,  0.685604f,  0.689849f,  0.689849f,  0.689849f,  0.688434f,  0.687019f,  0.685604f,  0.684189f,
+    0.687019f,  0.689849f,  0.638199f,  0.655416f,  0.672632f,  0.689849f,  0.689849f,  0.658010f,  0.637491f,
+    0.636784f,  0.636784f,  0.636784f,  0.636784f,  0.636784f,  0.636784f,  0.636784f,  0.636784f,  0.636784f,
+    0.626878f,  0.631831f,  0.636784f,  0.627232f,  0.617680f,  0.586903f,  0.592917f,  0.599638f,  0.583719f,
+    0.583719f,  0.636784f,  0.583719f,  0.590086f,  0.587964f,  0.585841f,  0.583719f,  0.583719f,  0.583719f,
+    0.583719f,  0.583719f,  0.583719f,  0.583719f,  0.583719f,  0.539144f,  0.561431f,  0.583719f,  0.557186f,
+    0.551879f,  0.554002f,  0.549757f,  0.545158f,  0.540559f,  0.535960f,  0.530653f,  0.530653f,  0.530653f,
+    0.549757f,  0.568860f,  0.530653f,  0.530653f,  0.530653f,  0.505182f,  0.517918f,  0.530653f,  0.522870f,
+    0.504121f,  0.499345f,  0.494569f,  0.489262f,  0.483956f,  0.481833f,  0.479711f,  0.477588f,  0.477588f,
+    0.477588f,  0.485017f,  0.492446f,  0.477588f,  0.477588f,  0.477588f,  0.477588f,  0.477588f,  0.477588f,
+    0.477588f,  0.471751f,  0.465914f,  0.456362f,  0.447871f,  0.439381f,  0.441655f,  0.443929f,  0.434226f,
+    0.424523f,  0.424523f,  0.424523f,  0.424523f,  0.424523f,  0.424523f,  0.426822f,  0.429122f,  0.431421f,
+    0.433721f,  0.464852f,  0.424523f,  0.424523f,  0.444687f,  0.424523f,  0.401174f,  0.402235f,  0.388438f,
+    0.397459f,  0.406480f,  0.415502f,  0.424523f,  0.414263f,  0.404004f,  0.387731f,  0.371457f,  0.371457f,
+    0.384900f,  0.371457f,  0.371590f,  0.371723f,  0.345986f,  0.334312f,  0.322637f,  0.338203f,  0.353769f,
+    0.353415f,  0.353061f,  0.352708f,  0.352354f,  0.335373f,  0.318392f,  0.321576f,  0.324760f,  0.327236f,
+    0.329713f,  0.320515f,  0.319453f,  0.318392f,  0.318392f,  0.318392f,  0.318392f,  0.318392f,  0.315739f,
+    0.313085f,  0.310432f,  0.307779f,  0.306718f,  0.305656f,  0.304595f,  0.265327f,  0.275940f,  0.291329f,
+    0.265327f,  0.265327f,  0.265327f,  0.265327f,  0.265327f,  0.265327f,  0.265327f,  0.265327f,  0.265327f,
+    0.265327f,  0.247638f,  0.229950f,  0.212261f,  0.242685f,  0.252945f,  0.263204f,  0.238794f,  0.220752f,
+    0.212261f,  0.214384f,  0.216507f,  0.218629f,  0.212261f,  0.223936f,  0.235610f,  0.212261f,  0.212261f,
+    0.212261f,  0.212261f,  0.212261f,  0.212261f,  0.198995f,  0.189974f,  0.186790f,  0.212261f,  0.212261f,
+    0.159196f,  0.174054f,  0.208016f,  0.212261f,  0.194219f,  0.176177f,  0.200941f,  0.188087f,  0.175233f,
+    0.162380f,  0.180422f,  0.154420f,  0.159196f,  0.159196f,  0.159196f,  0.159196f,  0.159196f,  0.159196f,
+    0.159196f,  0.120989f,  0.159196f,  0.132663f,  0.119397f,  0.106131f,  0.132663f,  0.148583f,  0.132663f,
+    0.130328f,  0.119291f,  0.108253f,  0.106131f,  0.106131f,  0.106131f,  0.106131f,  0.106131f,  0.130541f,
+    0.154951f,  0.109845f,  0.064740f,  0.058903f,  0.053065f,  0.098702f,  0.089150f,  0.065801f,  0.064740f,
+    0.063678f,  0.106131f,  0.057311f,  0.053065f,  0.075707f,  0.070046f,  0.063148f,  0.056249f,  0.101885f,
+    0.085612f,  0.069339f,  0.053065f,  0.019104f,  0.053065f,  0.026533f,  0.022641f,  0.053065f,  0.053065f,
+    0.046697f,  0.040330f,  0.016981f,  0.023083f,  0.029186f,  0.035288f,  0.041391f,  0.014858f,  0.000000f,
+    0.001061f,  0.002123f,  0.000000f,  0.000000f,  -0.007429f, -0.014858f, 0.000000f,  0.000000f,  0.000000f,
+    -0.006085f, -0.012170f, -0.018254f, -0.024339f, -0.030424f, 0.000000f,  0.000000f,  -0.027594f, -0.027594f,
+    -0.053065f, -0.053065f, -0.053065f, -0.045106f, -0.037146f, -0.045106f, -0.053065f, -0.053065f, -0.053065f,
+    -0.053065f, -0.050707f, -0.048348f, -0.045990f, -0.049528f, -0.053065f, -0.053065f, -0.106131f, -0.053065f,
+    -0.106131f, -0.053773f, -0.079952f, -0.106131f, -0.093395f, -0.106131f, -0.083843f, -0.091272f, -0.098702f,
+    -0.106131f, -0.106131f, -0.106131f, -0.057311f, -0.106131f, -0.106131f, -0.133725f, -0.113914f, -0.115329f,
+    -0.116744f, -0.137970f, -0.159196f, -0.150706f, -0.125234f, -0.118866f, -0.112498f, -0.106131f, -0.106131f,
+    -0.130010f, -0.153889f, -0.124173f, -0.159196f, -0.159196f, -0.150706f, -0.142215f, -0.134786f, -0.159196f,
+    -0.183606f, -0.159196f, -0.196342f, -0.188913f, -0.181483f, -0.174054f, -0.185729f, -0.186259f, -0.186790f,
+    -0.192096f, -0.171932f, -0.207167f, -0.212261f, -0.206247f, -0.200233f, -0.194219f, -0.212261f, -0.220752f,
+    -0.229242f, -0.212261f, -0.214384f, -0.216507f, -0.249407f, -0.212261f, -0.229950f, -0.265327f, -0.212261f,
+    -0.221106f, -0.229950f, -0.238794f, -0.236141f, -0.233487f, -0.265327f, -0.265327f, -0.265327f, -0.265327f,
+    -0.265327f, -0.265327f, -0.265327f, -0.269041f, -0.272756f, -0.273817f, -0.274878f, -0.280185f, -0.318392f,
+    -0.291859f, -0.265327f, -0.287083f, -0.308840f, -0.313085f, -0.304241f, -0.308958f, -0.313675f, -0.318392f,
+    -0.265327f, -0.318392f, -0.318392f, -0.304241f, -0.318392f, -0.318392f, -0.318392f, -0.318392f, -0.318392f,
+    -0.318392f, -0.318392f, -0.318392f, -0.333958f, -0.334429f, -0.334901f, -0.335373f, -0.337260f, -0.339146f,
+    -0.341033f, -0.318392f, -0.362967f, -0.340467f, -0.371457f, -0.371457f, -0.358722f, -0.371457f, -0.371457f,
+    -0.371457f, -0.359783f, -0.365620f, -0.371457f, -0.371457f, -0.350231f, -0.360844f, -0.371457f, -0.373580f,
+    -0.373580f, -0.377118f, -0.380655f, -0.384193f, -0.371457f, -0.386316f, -0.401174f, -0.402766f, -0.410018f,
+    -0.417270f, -0.424523f, -0.403296f, -0.382070f, -0.424523f, -0.424523f, -0.424523f, -0.424523f, -0.425372f,
+    -0.444334f, -0.452647f, -0.460961f, -0.469274f, -0.477588f, -0.450702f, -0.441504f, -0.436728f, -0.431952f,
+    -0.447341f, -0.462730f, -0.473343f, -0.471220f, -0.469097f, -0.477588f, -0.477588f, -0.477588f, -0.477588f,
+    -0.513672f, -0.477588f, -0.477588f, -0.477588f, -0.477588f, -0.477588f, -0.477588f, -0.481833f, -0.483956f,
+    -0.530653f, -0.514734f, -0.518979f, -0.523224f, -0.516219f, -0.530653f, -0.530653f, -0.543920f, -0.540603f,
+    -0.537286f, -0.533970f, -0.530653f, -0.530653f, -0.530653f, -0.530653f, -0.530653f, -0.547634f, -0.564615f,
+    -0.530653f, -0.552233f, -0.573813f, -0.557186f, -0.577351f, -0.583719f, -0.582834f, -0.581950f, -0.581065f,
+    -0.580181f, -0.581950f, -0.583719f, -0.558247f, -0.570983f, -0.583719f, -0.583719f, -0.604945f, -0.583719f,
+    -0.583719f, -0.590086f, -0.596454f, -0.602822f, -0.617680f, -0.590086f, -0.583719f, -0.636784f, -0.621926f,
+    -0.607067f, -0.603530f, -0.599992f, -0.636784f, -0.636784f, -0.636784f, -0.636784f, -0.659425f, -0.666147f,
+    -0.672868f, -0.648458f, -0.647397f, -0.646336f, -0.645274f, -0.678175f, -0.657479f, -0.636784f, -0.636784f,
+    -0.670746f, -0.636784f, -0.686665f, -0.683077f, -0.679489f, -0.675901f, -0.682875f, -0.689849f, -0.689319f,
+    -0.688788f, -0.716382f, -0.689849f, -0.689849f, -0.689849f, -0.689849f, -0.689849f, -0.689849f, -0.689849f,
+    -0.689849f, -0.738669f, -0.742915f, -0.742915f, -0.696217f, -0.707891f, -0.719566f, -0.716382f, -0.713198f,
+    -0.727632f, -0.742066f, -0.751193f, -0.760320f, -0.769447f, -0.756712f, -0.753262f, -0.749813f, -0.746364f,
+    -0.742915f, -0.785367f, -0.758480f, -0.769447f, -0.782714f, -0.795980f, -0.776876f, -0.795980f, -0.793857f,
+    -0.794388f, -0.794919f, -0.795449f, -0.795980f, -0.795980f, -0.795980f, -0.804470f, -0.800225f, -0.795980f,
+    -0.795980f, -0.795980f, -0.819329f, -0.795980f, -0.795980f, -0.812961f, -0.829942f, -0.846923f, -0.849045f,
+    -0.836310f, -0.829942f, -0.836310f, -0.842677f, -0.849045f, -0.831003f, -0.835602f, -0.840083f, -0.844564f,
+    -0.849045f, -0.849045f, -0.887252f, -0.868149f, -0.849045f, -0.849045f, -0.856474f, -0.863904f, -0.855413f,
+    -0.902111f, -0.859658f, -0.883007f, -0.859658f, -0.849045f, -0.902111f, -0.902111f, -0.902111f, -0.902111f,
+    -0.874517f, -0.902111f, -0.940318f, -0.921214f, -0.902111f, -0.902111f, -0.902111f, -0.915908f, -0.909009f,
+    -0.902111f, -0.902111f, -0.937770f, -0.902111f, -0.949869f, -0.935542f, -0.921214f, -0.955176f, -0.955176f,
+    -0.955707f, -0.955176f, -0.968442f, -0.981709f, -0.994975f, -1.008241f, -0.967912f, -1.003996f, -0.955176f,
+    -0.982770f, -0.955176f, -0.955176f, -0.981709f, -0.969504f, -0.957298f, -0.973218f, -1.008241f, -1.008241f,
+    -1.008241f, -1.008241f, -1.008241f, -1.008241f, -1.008241f, -1.008241f, -1.007003f, -1.005765f, -1.008241f,
+    -1.008241f, -1.008241f, -1.008241f, -1.008241f, -1.008241f, -1.032014f, -1.034986f, -1.037958f, -1.061307f,
+    -1.051755f, -1.054939f, -1.058123f, -1.061307f, -1.060599f, -1.059891f, -1.060599f, -1.061307f, -1.045387f,
+    -1.061307f, -1.061307f, -1.061307f, -1.099514f, -1.091023f, -1.082533f, -1.061307f, -1.063429f, -1.062368f,
+    -1.061307f, -1.076519f, -1.091731f, -1.100575f, -1.098098f, -1.095622f, -1.093146f, -1.097391f, -1.105881f,
+    -1.114372f, -1.114372f, -1.117438f, -1.120504f, -1.123570f, -1.120504f, -1.117438f, -1.114372f, -1.114372f,
+    -1.128169f, -1.137190f, -1.167437f, -1.133475f, -1.167437f, -1.164253f, -1.161069f, -1.167437f, -1.146211f,
+    -1.153286f, -1.160362f, -1.167437f, -1.157885f, -1.162661f, -1.167437f, -1.167437f, -1.167437f, -1.177343f,
+    -1.167437f, -1.167437f, -1.183239f, -1.199041f, -1.214842f, -1.167437f, -1.193970f, -1.198333f, -1.202696f,
+    -1.207059f, -1.213781f, -1.220503f, -1.220503f, -1.181234f, -1.176458f, -1.171682f, -1.214135f, -1.217319f,
+    -1.220503f, -1.186541f, -1.220503f, -1.236422f, -1.241021f, -1.248804f, -1.256587f, -1.220503f, -1.221564f,
+    -1.222625f, -1.220503f, -1.273568f, -1.273568f, -1.257648f, -1.272507f, -1.247035f, -1.273568f, -1.290549f,
+    -1.307530f, -1.276752f, -1.273568f, -1.273568f, -1.273568f, -1.273568f, -1.273568f, -1.282058f, -1.273568f,
+    -1.303284f, -1.302223f, -1.297447f, -1.326633f, -1.313897f, -1.301162f, -1.304346f, -1.307530f, -1.326633f,
+    -1.313897f, -1.324511f, -1.318143f, -1.311775f, -1.305407f, -1.326633f, -1.326633f, -1.326633f, -1.326633f,
+    -1.331303f, -1.360595f, -1.328756f, -1.340961f, -1.353166f, -1.343614f, -1.359534f, -1.360595f, -1.366963f,
+    -1.373331f, -1.379698f, -1.379698f, -1.379698f, -1.379698f, -1.379698f, -1.379698f, -1.379698f, -1.379698f,
+    -1.335124f, -1.403047f, -1.379698f, -1.379698f, -1.401986f, -1.424273f, -1.410123f, -1.395972f, -1.381821f,
+    -1.390312f, -1.411538f, -1.432764f, -1.419321f, -1.413660f, -1.432764f, -1.432764f, -1.432764f, -1.432764f,
+    -1.432764f, -1.432764f, -1.432764f, -1.432764f, -1.432764f, -1.432764f, -1.443377f, -1.453990f, -1.437009f,
+    -1.453990f, -1.468848f, -1.468141f, -1.458235f, -1.467787f, -1.476808f, -1.485829f, -1.479461f, -1.463542f,
+    -1.447622f, -1.485829f, -1.485829f, -1.485829f, -1.485829f, -1.485829f, -1.485829f, -1.485829f, -1.489013f,
+    -1.502810f, -1.507055f, -1.538894f, -1.515546f, -1.490074f, -1.502810f, -1.533942f, -1.538894f, -1.538894f,
+    -1.538894f, -1.538894f, -1.538894f, -1.512362f, -1.525628f, -1.538894f, -1.509178f, -1.538894f, -1.537833f,
+    -1.538894f, -1.538894f, -1.538894f, -1.538894f, -1.538894f, -1.562243f, -1.561182f, -1.550038f, -1.538894f,
+    -1.538894f, -1.568611f, -1.587715f, -1.582054f, -1.576394f, -1.584177f, -1.591960f, -1.606818f, -1.591960f,
+    -1.591960f, -1.591960f, -1.591960f, -1.591960f, -1.604695f, -1.617431f, -1.630167f, -1.591960f, -1.607879f,
+    -1.645025f, -1.645025f, -1.645025f, -1.647047f, -1.647678f, -1.648310f, -1.648942f, -1.649574f, -1.650205f,
+    -1.650837f, -1.651469f, -1.652100f, -1.652732f, -1.653364f, -1.653996f, -1.654627f, -1.655259f, -1.655891f,
+    -1.656523f, -1.657154f, -1.657786f, -1.658418f, -1.659050f, -1.659681f, -1.660313f, -1.660945f, -1.698090f,
+    -1.698090f, -1.684293f, -1.670496f, -1.679694f, -1.688892f, -1.698090f, -1.672619f, -1.662006f, -1.680048f,
+    -1.698090f, -1.698090f, -1.707288f, -1.708527f, -1.709765f, -1.711003f, -1.712241f, -1.710826f, -1.709411f,
+    -1.707996f, -1.729576f, -1.751156f, -1.751156f, -1.751156f, -1.745319f, -1.739481f, -1.743878f, -1.747517f,
+    -1.751156f, -1.751156f, -1.751156f, -1.751156f, -1.762830f, -1.774505f, -1.762830f, -1.751156f, -1.751156f,
+    -1.768137f, -1.759646f, -1.751156f, -1.760708f, -1.770259f, -1.751156f, -1.781580f, -1.804221f, -1.804221f,
+    -1.796792f, -1.789363f, -1.796792f, -1.804221f, -1.804221f, -1.804221f, -1.804221f, -1.804221f, -1.804221f,
+    -1.804221f, -1.795731f, -1.803425f, -1.811120f, -1.830754f, -1.857286f, -1.838183f, -1.847735f, -1.857286f,
+    -1.810589f, -1.857286f, -1.857286f, -1.857286f, -1.857286f, -1.881696f, -1.842428f, -1.849857f, -1.857286f,
+    -1.857286f, -1.857286f, -1.857286f, -1.857286f, -1.864716f, -1.861001f, -1.857286f, -1.875329f, -1.893371f,
+    -1.881343f, -1.869315f, -1.857286f, -1.859409f, -1.891248f, -1.890541f, -1.881873f, -1.873206f, -1.888064f,
+    -1.906107f, -1.908229f, -1.910352f, -1.910352f, -1.910352f, -1.910352f, -1.910352f, -1.915305f, -1.920257f,
+    -1.925210f, -1.928394f, -1.935823f, -1.949620f, -1.963417f, -1.961294f, -1.941130f, -1.940599f, -1.940068f,
+    -1.931578f, -1.936354f, -1.941130f, -1.923087f, -1.936531f, -1.949974f, -1.963417f, -1.963417f, -1.963417f,
+    -1.969431f, -1.975445f, -1.981459f, -1.989950f, -1.998794f, -1.999501f, -2.006931f, -1.963417f, -1.970316f,
+    -1.977214f, -1.995787f, -2.014360f, -2.015067f, -2.015775f, -2.016482f, -2.016482f, -2.016482f, -1.982521f,
+    -2.016482f, -2.032756f, -2.016482f, -2.016482f, -2.016482f, -2.016482f, -2.016482f, -2.054689f, -2.068486f,
+    -2.041954f, -2.033463f, -2.024973f, -2.016482f, -2.016482f, -2.035586f, -2.027095f, -2.024973f, -2.051152f,
+    -2.069548f, -2.063180f, -2.069548f, -2.076977f, -2.062649f, -2.048322f, -2.069548f, -2.069548f, -2.074500f,
+    -2.079453f, -2.084406f, -2.103510f, -2.122613f, -2.122613f, -2.112796f, -2.102979f, -2.112796f, -2.122613f,
+    -2.119694f, -2.116776f, -2.108020f, -2.099264f, -2.122613f, -2.122613f, -2.118368f, -2.114123f, -2.122613f,
+    -2.112000f, -2.122613f, -2.122613f, -2.122613f, -2.122613f, -2.143309f, -2.122613f, -2.156575f, -2.175678f,
+    -2.153391f, -2.164535f, -2.175678f, -2.175678f, -2.175678f, -2.175678f, -2.175678f, -2.141717f, -2.175678f,
+    -2.175678f, -2.175678f, -2.175678f, -2.175678f, -2.185230f, -2.204334f, -2.223437f, -2.175678f, -2.175678f,
+    -2.175678f, -2.192659f, -2.192659f, -2.192659f, -2.192659f, -2.210171f, -2.227682f, -2.228213f, -2.228744f,
+    -2.224923f, -2.221102f, -2.224923f, -2.228744f, -2.227152f, -2.225560f, -2.273319f, -2.228744f, -2.247847f,
+    -2.238295f, -2.228744f, -2.228744f, -2.280748f, -2.281809f, -2.281809f, -2.258991f, -2.236173f, -2.281809f,
+    -2.281809f, -2.281809f, -2.281809f, -2.281809f, -2.281809f, -2.281809f, -2.281809f, -2.281809f, -2.281809f,
+    -2.281809f, -2.281809f, -2.281809f, -2.281809f, -2.281809f, -2.315771f, -2.303389f, -2.334874f, -2.281809f,
+    -2.289238f, -2.296667f, -2.308872f, -2.321077f, -2.334874f, -2.334874f, -2.334874f, -2.334874f, -2.334874f,
+    -2.327976f, -2.321077f, -2.346549f, -2.334874f, -2.334874f, -2.334874f, -2.334874f, -2.379449f, -2.366714f,
+    -2.353978f, -2.353978f, -2.366714f, -2.368954f, -2.371195f, -2.373435f, -2.375676f, -2.377916f, -2.380157f,
+    -2.381572f, -2.382987f, -2.381218f, -2.384579f, -2.387940f, -2.387940f, -2.387940f, -2.402798f, -2.417656f,
+    -2.407751f, -2.397845f, -2.387940f, -2.389355f, -2.390770f, -2.410581f, -2.430392f, -2.438882f, -2.409166f,
+    -2.389001f, -2.428269f, -2.434637f, -2.441005f, -2.441005f, -2.441005f, -2.439944f, -2.434637f, -2.436760f,
+    -2.438882f, -2.441005f, -2.437467f, -2.438647f, -2.439826f, -2.441005f, -2.441005f, -2.445250f, -2.443128f,
+    -2.441005f, -2.458517f, -2.453387f, -2.448257f, -2.443128f, -2.489118f, -2.453741f, -2.460816f, -2.467891f,
+    -2.474967f, -2.494070f, -2.494070f, -2.494070f, -2.494070f, -2.481335f, -2.494070f, -2.494070f, -2.494070f,
+    -2.494070f, -2.494070f, -2.471783f, -2.494070f, -2.494070f, -2.494070f, -2.494070f, -2.494070f, -2.499908f,
+    -2.505745f, -2.504683f, -2.518834f, -2.532985f, -2.499377f, -2.514412f, -2.529447f, -2.538291f, -2.547136f,
+    -2.553503f, -2.547136f, -2.550054f, -2.552973f, -2.555891f, -2.558810f, -2.547136f, -2.547136f, -2.547136f,
+    -2.547136f, -2.547136f, -2.590649f, -2.595956f, -2.568362f, -2.581628f, -2.594894f, -2.600201f, -2.547136f,
+    -2.560402f, -2.573668f, -2.586935f, -2.600201f, -2.600201f, -2.595956f, -2.600201f, -2.612406f, -2.624611f,
+    -2.612406f, -2.600201f, -2.600201f, -2.625672f, -2.607630f, -2.600201f, -2.653266f, -2.626734f, -2.600201f,
+    -2.621427f, -2.642653f, -2.633101f, -2.623550f, -2.630979f, -2.638408f, -2.645837f, -2.653266f, -2.653266f,
+    -2.653266f, -2.653266f, -2.653266f, -2.649817f, -2.646368f, -2.648667f, -2.650967f, -2.653266f, -2.676615f,
+    -2.688289f, -2.699964f, -2.657512f, -2.675978f, -2.694445f, -2.706332f, -2.692004f, -2.677676f, -2.687759f,
+    -2.697841f, -2.706332f, -2.706332f, -2.706332f, -2.706332f, -2.706332f, -2.706332f, -2.706332f, -2.706332f,
+    -2.706332f, -2.733926f, -2.706332f, -2.706332f, -2.751968f, -2.729680f, -2.724374f, -2.706332f, -2.711108f,
+    -2.715883f, -2.720659f, -2.725435f, -2.727558f, -2.729680f, -2.735694f, -2.741709f, -2.750553f, -2.759397f,
+    -2.759397f, -2.759397f, -2.759397f, -2.759397f, -2.759397f, -2.774963f, -2.790529f, -2.806094f, -2.801053f,
+    -2.796012f, -2.790971f, -2.785930f, -2.777085f, -2.768241f, -2.759397f, -2.785930f, -2.812462f, -2.805564f,
+    -2.798665f, -2.788052f, -2.812462f, -2.812462f, -2.812462f, -2.802557f, -2.805033f, -2.807510f, -2.809986f,
+    -2.812462f, -2.812462f, -2.812462f, -2.814467f, -2.816472f, -2.818476f, -2.817592f, -2.816708f, -2.847839f,
+    -2.852261f, -2.856683f, -2.861105f, -2.865528f, -2.865528f, -2.865528f, -2.865528f, -2.842179f, -2.853853f,
+    -2.865528f, -2.865528f, -2.865528f, -2.870622f, -2.875716f, -2.880810f, -2.885905f, -2.890999f, -2.896093f,
+    -2.901188f, -2.906282f, -2.911376f, -2.916470f, -2.865528f, -2.871895f, -2.878263f, -2.865528f, -2.892060f,
+    -2.889938f, -2.900551f, -2.865528f, -2.901612f, -2.871895f, -2.886223f, -2.900551f, -2.896305f, -2.892060f,
+    -2.918593f, -2.865528f, -2.887815f, -2.910102f, -2.936635f, -2.963168f, -2.938404f, -2.913640f, -2.918593f,
+    -2.918593f, -2.918593f, -2.918593f, -2.922042f, -2.925491f, -2.928941f, -2.932390f, -2.925491f, -2.918593f,
+    -2.923899f, -2.918593f, -2.918593f, -2.965290f, -2.959984f, -2.954677f, -2.962106f, -2.971658f, -2.971658f,
+    -2.927083f, -2.934513f, -2.941942f, -2.949371f, -2.956800f, -2.964229f, -2.971658f, -2.971658f, -2.959984f,
+    -2.963875f, -2.967767f, -2.971658f, -2.984394f, -2.976965f, -3.000314f, -2.971658f, -2.998191f, -3.003497f,
+    -3.008804f, -3.014111f, -3.021540f, -3.022601f, -3.023662f, -3.024724f, -3.024724f, -3.024724f, -3.024724f,
+    -3.021752f, -3.018780f, -3.015809f, -3.038167f, -3.037931f, -3.037695f, -3.037459f, -3.024724f, -3.051256f,
+    -3.024724f, -3.024724f, -3.024724f, -3.024724f, -3.032153f, -3.028438f, -3.024724f, -3.043827f, -3.049134f,
+    -3.054440f, -3.043827f, -3.051964f, -3.060100f, -3.068945f, -3.077789f, -3.122364f, -3.077789f, -3.077789f,
+    -3.077789f, -3.077789f, -3.077789f, -3.077789f, -3.077789f, -3.077789f, -3.091586f, -3.091232f, -3.130854f,
+    -3.120241f, -3.109628f, -3.094770f, -3.079912f, -3.103260f, -3.126609f, -3.102199f, -3.077789f, -3.109628f,
+    -3.130854f, -3.130854f, -3.130854f, -3.152080f, -3.130854f, -3.130854f, -3.130854f, -3.130854f, -3.130854f,
+    -3.130854f, -3.130854f, -3.130854f, -3.130854f, -3.130854f, -3.130854f, -3.161986f, -3.168590f, -3.175193f,
+    -3.181797f, -3.175429f, -3.169061f, -3.162693f, -3.158448f, -3.183920f, -3.180736f, -3.165347f, -3.149958f,
+    -3.166939f, -3.183920f, -3.183920f, -3.183920f, -3.183920f, -3.183920f, -3.183920f, -3.183920f, -3.183920f,
+    -3.183920f, -3.183920f, -3.183920f, -3.183920f, -3.183920f, -3.197186f, -3.210452f, -3.224249f, -3.234862f,
+    -3.235570f, -3.236277f, -3.236985f, -3.183920f, -3.210452f, -3.236985f, -3.231678f, -3.236985f, -3.226372f,
+    -3.236985f, -3.236985f, -3.236985f, -3.236985f, -3.236985f, -3.236985f, -3.236985f, -3.236985f, -3.236985f,
+    -3.248659f, -3.260334f, -3.256088f, -3.251843f, -3.236985f, -3.262456f, -3.272362f, -3.249721f, -3.290050f,
+    -3.247598f, -3.290050f, -3.290050f, -3.276784f, -3.263518f, -3.276784f, -3.290050f, -3.290050f, -3.290050f,
+    -3.290050f, -3.290050f, -3.290050f, -3.290050f, -3.290050f, -3.290050f, -3.290050f, -3.290050f, -3.290050f,
+    -3.290050f, -3.290050f, -3.300663f, -3.303670f, -3.306677f, -3.309684f, -3.312691f, -3.321536f, -3.330380f,
+    -3.336748f, -3.343116f, -3.343116f, -3.343116f, -3.343116f, -3.343116f, -3.343116f, -3.343116f, -3.343116f,
+    -3.343116f, -3.343381f, -3.343646f, -3.343912f, -3.344177f, -3.343116f, -3.391936f, -3.367526f, -3.343116f,
+    -3.341347f, -3.343116f, -3.396181f, -3.396181f, -3.396181f, -3.396181f, -3.396181f, -3.394058f, -3.391936f,
+    -3.389813f, -3.370356f, -3.350898f, -3.373540f, -3.396181f, -3.396181f, -3.396181f, -3.396181f, -3.396181f,
+    -3.377785f, -3.396181f, -3.396181f, -3.396181f, -3.396181f, -3.396181f, -3.396888f, -3.397596f, -3.398303f,
+    -3.397596f, -3.396888f, -3.396181f, -3.402549f, -3.397242f, -3.413869f, -3.400426f, -3.403787f, -3.407148f,
+    -3.410509f, -3.413869f, -3.405025f, -3.396181f, -3.415815f, -3.435449f, -3.438633f, -3.441817f, -3.449246f,
+    -3.438633f, -3.448185f, -3.457737f, -3.417407f, -3.447124f, -3.449246f, -3.451369f, -3.453491f, -3.432265f,
+    -3.449246f, -3.449246f, -3.449246f, -3.449246f, -3.449246f, -3.473656f, -3.461451f, -3.449246f, -3.460921f,
+    -3.449246f, -3.468350f, -3.477194f, -3.486038f, -3.494882f, -3.502312f, -3.475779f, -3.449246f, -3.502312f,
+    -3.502312f, -3.502312f, -3.502312f, -3.502312f, -3.500189f, -3.498066f, -3.451369f, -3.464812f, -3.478255f,
+    -3.491698f, -3.497005f, -3.502312f, -3.555377f, -3.502312f, -3.510271f, -3.518231f, -3.526191f, -3.534151f,
+    -3.506557f, -3.523538f, -3.524599f, -3.525660f, -3.502312f, -3.517435f, -3.532559f, -3.540165f, -3.547771f,
+    -3.555377f, -3.555377f, -3.551132f, -3.546886f, -3.542641f, -3.546886f, -3.551132f, -3.555377f, -3.533443f,
+    -3.544410f, -3.555377f, -3.555377f, -3.555377f, -3.555377f, -3.555377f, -3.555377f, -3.555377f, -3.555377f,
+    -3.555377f, -3.555377f, -3.608442f, -3.599686f, -3.590931f, -3.582175f, -3.573419f, -3.564398f, -3.555377f,
+    -3.555377f, -3.555377f, -3.597122f, -3.602782f, -3.608442f, -3.595706f, -3.602074f, -3.608442f, -3.580848f,
+    -3.555377f, -3.581910f, -3.608442f, -3.608442f, -3.608442f, -3.608442f, -3.608442f, -3.608442f, -3.608442f,
+    -3.608442f, -3.608442f, -3.608442f, -3.608442f, -3.616023f, -3.623604f, -3.631184f, -3.638765f, -3.646346f,
+    -3.653927f, -3.661508f, -3.653017f, -3.644527f, -3.642404f, -3.640281f, -3.608442f, -3.637451f, -3.661507f,
+    -3.648772f, -3.648772f, -3.648772f, -3.648772f, -3.648772f, -3.644527f, -3.640281f, -3.636036f, -3.659385f,
+    -3.661507f, -3.661507f, -3.661507f, -3.661507f, -3.642404f, -3.647003f, -3.651602f, -3.665753f, -3.664338f,
+    -3.662923f, -3.661507f, -3.661507f, -3.661507f, -3.661507f, -3.661507f, -3.661508f, -3.661508f, -3.661507f,
+    -3.661508f, -3.661508f, -3.678223f, -3.694939f, -3.697857f, -3.700776f, -3.689101f, -3.697592f, -3.706082f,
+    -3.714573f, -3.714573f, -3.714573f, -3.714573f, -3.714573f, -3.714573f, -3.714573f, -3.714573f, -3.714573f,
+    -3.733676f, -3.752780f, -3.714573f, -3.723063f, -3.723329f, -3.723594f, -3.723859f, -3.724125f, -3.735799f,
+    -3.730492f, -3.725186f, -3.719879f, -3.714573f, -3.723063f, -3.714573f, -3.767638f, -3.731554f, -3.717757f,
+    -3.721648f, -3.725540f, -3.729431f, -3.714573f, -3.732261f, -3.749950f, -3.767638f, -3.766577f, -3.765516f,
+    -3.766046f, -3.766577f, -3.767107f, -3.767638f, -3.767638f, -3.767638f, -3.767638f, -3.767638f, -3.767638f,
+    -3.767638f, -3.771277f, -3.774916f, -3.778554f, -3.782193f, -3.785832f, -3.789471f, -3.793110f, -3.802661f,
+    -3.794701f, -3.786742f, -3.800539f, -3.802838f, -3.805138f, -3.795763f, -3.786388f, -3.777013f, -3.767638f,
+    -3.784619f, -3.820703f, -3.790987f, -3.805845f, -3.820703f, -3.793110f, -3.820703f, -3.822030f, -3.823357f,
+    -3.824683f, -3.826010f, -3.825678f, -3.825347f, -3.825015f, -3.824683f, -3.824352f, -3.824020f, -3.823688f,
+    -3.823357f, -3.823025f, -3.822693f, -3.822362f, -3.822030f, -3.821698f, -3.821367f, -3.821035f, -3.820703f,
+    -3.820703f, -3.841930f, -3.831317f, -3.820703f, -3.830255f, -3.839807f, -3.820703f, -3.822826f, -3.824949f,
+    -3.827071f, -3.826010f, -3.824949f, -3.841222f, -3.857495f, -3.873769f, -3.870585f, -3.867401f, -3.858911f,
+    -3.873769f, -3.873769f, -3.873769f, -3.873769f, -3.873769f, -3.873769f, -3.873769f, -3.873769f, -3.873769f,
+    -3.873769f, -3.873769f, -3.873769f, -3.873769f, -3.873769f, -3.873769f, -3.873769f, -3.885443f, -3.890750f,
+    -3.892872f, -3.894995f, -3.916221f, -3.878014f, -3.885089f, -3.892165f, -3.899240f, -3.906316f, -3.913391f,
+    -3.920466f, -3.873769f, -3.873769f, -3.892342f, -3.910915f, -3.918344f, -3.902070f, -3.910325f, -3.918580f,
+    -3.926834f, -3.926834f, -3.926834f, -3.926834f, -3.926834f, -3.926834f, -3.926834f, -3.926834f, -3.926834f,
+    -3.937801f, -3.948768f, -3.940985f, -3.933202f, -3.937447f, -3.934794f, -3.932141f, -3.929487f, -3.926834f,
+    -3.930814f, -3.934794f, -3.938774f, -3.942754f, -3.943815f, -3.935325f, -3.926834f, -3.953367f, -3.979899f,
+    -3.943815f, -3.979899f, -3.979899f, -3.979899f, -3.971055f, -3.962211f, -3.953367f, -3.944523f, -3.935678f,
+    -3.926834f, -3.949122f, -3.971409f, -3.970878f, -3.970348f, -3.969817f, -3.984145f, -3.983296f, -3.982447f,
+    -3.981598f, -3.980748f, -3.979899f, -3.967164f, -3.954428f, -3.941692f, -3.928957f, -3.979899f, -3.979899f,
+    -3.979899f, -3.979899f, -3.979899f, -3.979899f, -3.979899f, -3.979899f, -4.015984f, -3.979899f, -3.997588f,
+    -4.015276f, -4.032965f, -4.017045f, -4.025005f, -4.032965f, -4.015984f, -3.999003f, -4.010324f, -4.021644f,
+    -4.032965f, -4.001126f, -4.015984f, -4.026597f, -4.028189f, -4.029781f, -4.031373f, -4.032965f, -4.032965f,
+    -4.032965f, -4.032965f, -4.032965f, -4.032965f, -4.032965f, -4.032965f, -4.032965f, -4.032965f, -4.032965f,
+    -4.032965f, -4.037210f, -4.041455f, -4.045700f, -4.039333f, -4.032965f, -4.032965f, -4.032965f, -4.032965f,
+    -4.032965f, -4.036679f, -4.040394f, -4.044108f, -4.047823f, -4.035087f, -4.046054f, -4.057021f, -4.069049f,
+    -4.064273f, -4.059497f, -4.063920f, -4.068342f, -4.072764f, -4.077186f, -4.081608f, -4.086030f, -4.086030f,
+    -4.086030f, -4.086030f, -4.086030f, -4.086030f, -4.086030f, -4.086030f, -4.086030f, -4.086030f, -4.086030f,
+    -4.086030f, -4.065865f, -4.086030f, -4.086030f, -4.086030f, -4.086030f, -4.086030f, -4.086030f, -4.086030f,
+    -4.126360f, -4.106195f, -4.086030f, -4.112563f, -4.114155f, -4.115747f, -4.111501f, -4.107256f, -4.117869f,
+    -4.128482f, -4.139095f, -4.133435f, -4.127775f, -4.122115f, -4.122822f, -4.105134f, -4.139095f, -4.139095f,
+    -4.139095f, -4.139095f, -4.139095f, -4.139095f, -4.139095f, -4.139095f, -4.139095f, -4.139095f, -4.139095f,
+    -4.129190f, -4.119284f, -4.109379f, -4.103011f, -4.096643f, -4.090275f, -4.114685f, -4.139095f, -4.159260f,
+    -4.149178f, -4.139095f, -4.151831f, -4.139095f, -4.141622f, -4.144149f, -4.146676f, -4.149203f, -4.151730f,
+    -4.154257f, -4.156784f, -4.190038f, -4.158199f, -4.161171f, -4.164142f, -4.167114f, -4.170086f, -4.173057f,
+    -4.180133f, -4.186147f, -4.192161f, -4.188977f, -4.185793f, -4.187916f, -4.190038f, -4.192161f, -4.139095f,
+    -4.156784f, -4.174472f, -4.192161f, -4.193753f, -4.195345f, -4.193753f, -4.192161f, -4.192161f, -4.192161f,
+    -4.192161f, -4.192161f, -4.192161f, -4.192161f, -4.192161f, -4.201713f, -4.211264f, -4.220816f, -4.230368f,
+    -4.245226f, -4.178364f, -4.185262f, -4.192161f, -4.192161f, -4.192161f, -4.218693f, -4.245226f, -4.245226f,
+    -4.245226f, -4.245226f, -4.215509f, -4.228245f, -4.220462f, -4.212679f, -4.204896f, -4.226123f, -4.225061f,
+    -4.224000f, -4.245226f, -4.228245f, -4.236736f, -4.245226f, -4.245226f, -4.245226f, -4.245226f, -4.245226f,
+    -4.245226f, -4.245226f, -4.245226f, -4.192161f, -4.209849f, -4.227538f, -4.245226f, -4.245226f, -4.245226f,
+    -4.245226f, -4.245226f, -4.245226f, -4.245226f, -4.245226f, -4.245226f, -4.245226f, -4.245226f, -4.245226f,
+    -4.245226f, -4.245226f, -4.245226f, -4.245226f, -4.256193f, -4.267160f, -4.245226f, -4.264330f, -4.283433f,
+    -4.278127f, -4.272820f, -4.267514f, -4.262207f, -4.279188f, -4.296169f, -4.295638f, -4.295107f, -4.294577f,
+    -4.294046f, -4.295107f, -4.296169f, -4.297230f, -4.298291f, -4.264330f, -4.272820f, -4.281311f, -4.289801f,
+    -4.298291f, -4.298291f, -4.298291f, -4.298291f, -4.298291f, -4.298291f, -4.298291f, -4.298291f, -4.303244f,
+    -4.308197f, -4.298291f, -4.298291f, -4.298291f, -4.319518f, -4.298291f, -4.298291f, -4.298291f, -4.303386f,
+    -4.308480f, -4.313574f, -4.318668f, -4.323763f, -4.321994f, -4.320225f, -4.318456f, -4.324824f, -4.318191f,
+    -4.311558f, -4.304925f, -4.298291f, -4.298291f, -4.315980f, -4.333668f, -4.351357f, -4.346050f, -4.340744f,
+    -4.335437f, -4.340744f, -4.346050f, -4.351357f, -4.349234f, -4.347112f, -4.344989f, -4.343928f, -4.342866f,
+    -4.344989f, -4.347112f, -4.349234f, -4.351357f, -4.351357f, -4.351357f, -4.351357f, -4.351357f, -4.351357f,
+    -4.351357f, -4.351357f, -4.351357f, -4.351357f, -4.357194f, -4.363031f, -4.375767f, -4.388502f, -4.369930f,
+    -4.351357f, -4.351357f, -4.355602f, -4.359847f, -4.364092f, -4.368338f, -4.367630f, -4.366923f, -4.366215f,
+    -4.361970f, -4.357725f, -4.395224f, -4.396639f, -4.398054f, -4.399469f, -4.400884f, -4.402299f, -4.376828f,
+    -4.351357f, -4.369045f, -4.386734f, -4.404422f, -4.372583f, -4.370460f, -4.368338f, -4.386380f, -4.404422f,
+    -4.404422f, -4.404422f, -4.404422f, -4.404422f, -4.404422f, -4.404422f, -4.404422f, -4.404422f, -4.404422f,
+    -4.404422f, -4.404422f, -4.404422f, -4.404422f, -4.404422f, -4.412913f, -4.421403f, -4.429893f, -4.421403f,
+    -4.412913f, -4.404422f, -4.404422f, -4.404422f, -4.404422f, -4.421403f, -4.438384f, -4.455365f, -4.456426f,
+    -4.457487f, -4.448997f, -4.440506f, -4.432016f, -4.457487f, -4.442629f, -4.419280f, -4.421934f, -4.424587f,
+    -4.426709f, -4.428832f, -4.430955f, -4.433077f, -4.441214f, -4.449351f, -4.457487f, -4.448466f, -4.439445f,
+    -4.430424f, -4.421403f, -4.443690f, -4.465978f, -4.463148f, -4.460318f, -4.457487f, -4.457487f, -4.457487f,
+    -4.457487f, -4.457487f, -4.472346f, -4.487204f, -4.502062f, -4.457487f, -4.457487f, -4.457487f, -4.626574f,
+    -4.795660f };
@@ -1,4 +1,6 @@
 #include "adc_logger.h"
+#include "capture.h"
+#include "LUT.h"
 #include "driver/gpio.h"
 #include "driver/gptimer.h"
 #include "driver/spi_master.h"
@@ -176,19 +178,70 @@ void adc_logger_run( void )
   wait_release();
   ESP_LOGI( TAG, "Captured %d samples", sample_index );
 
-  if ( init_sdcard() != ESP_OK ) return;
+  // the local sample array goes out through the same view path as the capture store
+  capture_view_t view = {
+      .base  = samples,
+      .size  = LOGGER_MAX_SAMPLES,
+      .start = 0,
+      .len   = sample_index,
+  };
+  adc_logger_save_view( &view, LOGGER_SAMPLE_RATE_HZ );
+}
+
+// ==== VIEW -> CSV ====
+// frame (may be NULL) adds the record's columns: mv, the sample through its range's
+// calibration, and gap, 1 on the first sample after samples were lost
+static esp_err_t save_csv( const capture_view_t *view, uint32_t sample_rate_hz,
+                           const capture_frame_t *frame )
+{
+  static bool mounted = false;
+  if ( !mounted )
+  {
+    esp_err_t ret = init_sdcard();
+    if ( ret != ESP_OK ) return ret;
+    mounted = true;
+  }
 
   FILE *f = fopen( "/sdcard/data.csv", "w" );
   if ( !f )
   {
     ESP_LOGE( TAG, "CSV open failed!" );
-    return;
+    return ESP_FAIL;
   }
 
-  fprintf( f, "time_s,adc_raw\n" );
-  for ( int i = 0; i < sample_index; i++ )
-    fprintf( f, "%f,%u\n", (float)i / LOGGER_SAMPLE_RATE_HZ, samples[i] );
+  // walk the (possibly wrapped) window in place, no copy out of the store
+  if ( frame == NULL )
+  {
+    fprintf( f, "time_s,adc_raw\n" );
+    for ( uint32_t i = 0; i < view->len; i++ )
+      fprintf( f, "%f,%u\n", (float)i / sample_rate_hz, capture_view_at( view, i ) );
+  }
+  else
+  {
+    uint32_t n_gaps = ( frame->gaps < CAPTURE_MAX_GAPS ) ? frame->gaps : CAPTURE_MAX_GAPS;
+    uint32_t g = 0;
+    fprintf( f, "time_s,adc_raw,mv,gap\n" );
+    for ( uint32_t i = 0; i < view->len; i++ )
+    {
+      uint16_t s = capture_view_at( view, i );
+      int gap = ( g < n_gaps && frame->gap_at[g] == i );
+      if ( gap ) g++;
+      fprintf( f, "%f,%u,%ld,%d\n", (float)i / sample_rate_hz, s,
+               (long)adc_lut_mv( frame->range, s, frame->frac_bits ), gap );
+    }
+  }
   fclose( f );
 
-  ESP_LOGI( TAG, "Saved: /sdcard/data.csv" );
+  ESP_LOGI( TAG, "Saved %lu samples: /sdcard/data.csv", (unsigned long)view->len );
+  return ESP_OK;
+}
+
+esp_err_t adc_logger_save_view( const capture_view_t *view, uint32_t sample_rate_hz )
+{
+  return save_csv( view, sample_rate_hz, NULL );
+}
+
+esp_err_t adc_logger_save_frame( const capture_frame_t *frame )
+{
+  return save_csv( &frame->view, frame->rate_hz, frame );
 }
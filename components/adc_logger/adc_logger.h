@@ -1,6 +1,16 @@
 #pragma once
 
+#include "capture.h"
+#include "esp_err.h"
+
 // Configuration for raw ADC data acquisition
 // blocks until button is pressed -> logs -> button pressed again to stop
 // then saves csv to SD card
 void adc_logger_run( void );
+
+// writes a capture view (e.g. a frame from capture_take_frame()) to /sdcard/data.csv, mounting the card on first use
+esp_err_t adc_logger_save_view( const capture_view_t *view, uint32_t sample_rate_hz );
+
+// same for a captured record (channel 0), with its samples in mV and a gap column marking
+// where samples were lost
+esp_err_t adc_logger_save_frame( const capture_frame_t *frame );
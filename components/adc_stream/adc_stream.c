@@ -0,0 +1,473 @@
+#include "adc_stream.h"
+#include "config.h"
+#include "interleave.h"
+#include "esp_adc/adc_continuous.h"
+#include "driver/gptimer.h"
+#include "esp_log.h"
+#include "esp_cpu.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "soc/soc_caps.h"
+#include <stdatomic.h>
+
+static const char *TAG = "adc_stream";
+
+// scan pattern: the signal channels first, then the joystick axes. each channel gets
+// exactly one conversion per pattern cycle so every lane stays evenly spaced. interleaved,
+// the two paths sit half a pattern apart with a joystick axis between them, and their
+// lanes fill alternate slots of one block lane
+#define SCAN_LANES      SCOPE_CHANNELS
+#define LANE_STRIDE     (1 + ADC_STREAM_INTERLEAVE)     // block slots between two samples of a scan lane
+#define LANE_SAMPLES    (ADC_STREAM_BLOCK_SAMPLES / LANE_STRIDE)
+#define PATTERN_LEN     (SCAN_LANES + ADC_STREAM_NUM_AUX)
+#define FRAME_BYTES     (LANE_SAMPLES * PATTERN_LEN * SOC_ADC_DIGI_RESULT_BYTES)
+#define POOL_FRAMES     4
+#define LANE_AUX_X      SCAN_LANES
+#define LANE_AUX_Y      (SCAN_LANES + 1)
+#define LANE_NONE       0xff
+
+static const adc_channel_t scope_channels[] = SCOPE_ADC_CHANNELS;
+static adc_channel_t pattern_channels[PATTERN_LEN];
+static uint8_t lane_of[16];     // ADC channel (4 bit field in the DMA output) -> lane
+static uint16_t lane_base[SCAN_LANES]; // where each scan lane starts in block->samples
+
+static adc_continuous_handle_t adc_handle;
+static gptimer_handle_t ts_timer;  // free running, only read for timestamps
+static TaskHandle_t stream_task_handle;
+static adc_stream_block_cb_t block_cb;
+static void *block_ctx;
+static uint32_t stream_rate_hz;         // settings as configured, on the set_rate / set_range side
+static int stream_range = ADC_ATTEN_DB_12;
+static uint32_t acq_rate_hz;            // the stream task's copy, what blocks are stamped with
+static int acq_range;
+static bool running = false;
+static atomic_uint drop_req = 0;        // odd while a restart is under way, what the driver holds is at the old
+                                        // settings. the even bump after it publishes the new ones
+static volatile uint32_t pool_ovf = 0;  // bumped by the driver when its pool runs full
+static volatile uint32_t isr_last = 0;  // cycle count at the last frame interrupt, 0 = none yet
+static volatile uint32_t isr_min = UINT32_MAX; // shortest / longest interval between them, in CPU cycles
+static volatile uint32_t isr_max = 0;
+#if ADC_STREAM_JITTER_HIST
+static volatile uint32_t isr_nominal = 1;   // nominal interval at the current rate, in CPU cycles
+static volatile uint32_t isr_hist[ADC_STREAM_JITTER_BUCKETS];
+#define BUCKET_CYCLES   (ADC_STREAM_JITTER_BUCKET_NS * CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ / 1000)
+#endif
+static uint32_t block_seq = 0;          // next block number. skips one per pool overflow
+static volatile uint32_t blocks_out = 0; // blocks handed to the callback
+static volatile uint16_t aux_raw[ADC_STREAM_NUM_AUX];
+static uint16_t lane_fill[SCAN_LANES]; // samples in each lane of the block being built
+static interleave_cal_t ilv_cal;
+static interleave_stats_t ilv_stats;
+static volatile uint32_t cal_req = 0;   // bumped to start a calibration
+static uint32_t cal_left = 0;           // blocks still going into ilv_stats
+
+// DMA frame done ISR: wake the stream task. the interval since the last one is tracked,
+// the interrupt always runs on ACQ_CORE so its cycle counter is a steady clock
+IRAM_ATTR static bool conv_done_cb(adc_continuous_handle_t handle,
+                                   const adc_continuous_evt_data_t *edata,
+                                   void *user_data)
+{
+    uint32_t now = esp_cpu_get_cycle_count();
+    if (isr_last != 0) {
+        uint32_t d = now - isr_last;
+        if (d < isr_min) { isr_min = d;}
+        if (d > isr_max) { isr_max = d;}
+#if ADC_STREAM_JITTER_HIST
+        int32_t b = ((int32_t)(d - isr_nominal) + ADC_STREAM_JITTER_BUCKETS / 2 * BUCKET_CYCLES) / BUCKET_CYCLES;
+        if (b < 0) { b = 0;}
+        if (b >= ADC_STREAM_JITTER_BUCKETS) { b = ADC_STREAM_JITTER_BUCKETS - 1;}
+        isr_hist[b]++;
+#endif
+    }
+    isr_last = now;
+
+    BaseType_t hp = pdFALSE;
+    vTaskNotifyGiveFromISR(stream_task_handle, &hp);
+    return (hp == pdTRUE);
+}
+
+// pool full ISR: the driver flushes what it held, conversions are gone
+IRAM_ATTR static bool pool_ovf_cb(adc_continuous_handle_t handle,
+                                  const adc_continuous_evt_data_t *edata,
+                                  void *user_data)
+{
+    pool_ovf++;
+    return false;
+}
+
+static uint32_t cycles_to_ns(uint32_t cycles)
+{
+    return (uint32_t)((uint64_t)cycles * 1000 / CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ);
+}
+
+static uint64_t samples_to_ticks(uint32_t n)
+{
+    return (uint64_t)n * TIMER_RESOLUTION_HZ / acq_rate_hz;
+}
+
+// start the block over, all lanes empty
+static void block_reset(adc_block_t *block)
+{
+    block->count = 0;
+    for (int c = 0; c < SCAN_LANES; c++) { lane_fill[c] = 0;}
+}
+
+// interleaved block: feeds a calibration in progress with the raw pairs, then pulls both
+// paths onto the same offset and gain
+static void interleave_block(adc_block_t *block)
+{
+    static uint32_t cal_seen = 0;
+    if (cal_seen != cal_req) {
+        cal_seen = cal_req;
+        interleave_stats_reset(&ilv_stats);
+        cal_left = ADC_STREAM_CAL_BLOCKS;
+    }
+    if (cal_left > 0) {
+        interleave_stats_add(&ilv_stats, block->samples[0], block->count);
+        if (--cal_left == 0 && interleave_cal_estimate(&ilv_stats, &ilv_cal)) {
+            ESP_LOGI(TAG, "interleave cal: gain %ld / %ld, offset %ld / %ld (Q%d)",
+                     (long)ilv_cal.gain[0], (long)ilv_cal.gain[1],
+                     (long)ilv_cal.offset[0], (long)ilv_cal.offset[1], INTERLEAVE_GAIN_BITS);
+        }
+    }
+    interleave_correct(&ilv_cal, block->samples[0], block->count);
+}
+
+// splits one DMA frame into the signal lanes of block and the aux readings: one table
+// lookup per conversion instead of comparing against every channel. a block starts on
+// a channel 0 conversion and no lane runs ahead of channel 0, so a frame that starts
+// mid pattern or a lost conversion can't shift the lanes against each other.
+// t0 is the timestamp of the first channel 0 sample in the frame
+static void demux_frame(const uint8_t *frame, uint32_t len, adc_block_t *block, uint64_t t0)
+{
+    const adc_digi_output_data_t *p = (const adc_digi_output_data_t *)frame;
+    const adc_digi_output_data_t *end = p + len / SOC_ADC_DIGI_RESULT_BYTES;
+    uint16_t *dst = &block->samples[0][0];
+    uint32_t sig = 0; // channel 0 samples seen in this frame
+
+    for (; p < end; p++) {
+        uint32_t lane = lane_of[p->type1.channel];
+        uint16_t data = p->type1.data;
+
+        if (lane == 0) {
+            if (lane_fill[0] == 0) {
+                block->timestamp = t0 + samples_to_ticks(sig * LANE_STRIDE);
+                block->rate_hz = acq_rate_hz;
+                block->range = acq_range;
+            }
+            sig++;
+            if (lane_fill[0] < LANE_SAMPLES) { dst[lane_fill[0]++ * LANE_STRIDE] = data;}
+        } else if (lane < SCAN_LANES) {
+            if (lane_fill[lane] < lane_fill[0]) { dst[lane_base[lane] + lane_fill[lane]++ * LANE_STRIDE] = data;}
+        } else if (lane == LANE_AUX_X) {
+            aux_raw[0] = data;
+            continue;
+        } else if (lane == LANE_AUX_Y) {
+            aux_raw[1] = data;
+            continue;
+        } else {
+            continue;
+        }
+
+        // the last lane fills last
+        if (lane_fill[SCAN_LANES - 1] == LANE_SAMPLES) {
+            block->count = ADC_STREAM_BLOCK_SAMPLES;
+            block->seq = block_seq++;
+            if (ADC_STREAM_INTERLEAVE) { interleave_block(block);}
+            block_cb(block, block_ctx);
+            blocks_out++;
+            block_reset(block);
+        }
+    }
+}
+
+static uint32_t clamp_rate(uint32_t rate_hz)
+{
+    if (rate_hz < ADC_STREAM_MIN_RATE_HZ) { rate_hz = ADC_STREAM_MIN_RATE_HZ;}
+    if (rate_hz > adc_stream_max_rate()) { rate_hz = adc_stream_max_rate();}
+    return rate_hz;
+}
+
+static esp_err_t stream_configure(uint32_t rate_hz, int range)
+{
+    adc_digi_pattern_config_t pattern[PATTERN_LEN];
+    for (int i = 0; i < PATTERN_LEN; i++) {
+        bool aux = lane_of[pattern_channels[i]] >= SCAN_LANES;
+        pattern[i].atten = aux ? ADC_ATTEN_DB_12 : range;
+        pattern[i].channel = pattern_channels[i];
+        pattern[i].unit = ADC_UNIT_1;
+        pattern[i].bit_width = ADC_BITWIDTH_12;
+    }
+
+    adc_continuous_config_t cfg = {
+        .pattern_num = PATTERN_LEN,
+        .adc_pattern = pattern,
+        .sample_freq_hz = rate_hz * PATTERN_LEN / LANE_STRIDE, // conversion rate covers the whole pattern
+        .conv_mode = ADC_CONV_SINGLE_UNIT_1,     // ESP32 only supports DMA on ADC1
+        .format = ADC_DIGI_OUTPUT_FORMAT_TYPE1,
+    };
+    esp_err_t err = adc_continuous_config(adc_handle, &cfg);
+    if (err == ESP_OK) {
+        stream_rate_hz = rate_hz;
+        stream_range = range;
+    }
+    return err;
+}
+
+// the driver is set up from the stream task: the DMA interrupt is allocated on the core
+// that creates the handle, and it belongs on ACQ_CORE with the rest of acquisition
+static void stream_setup(void)
+{
+    adc_continuous_handle_cfg_t handle_cfg = {
+        .max_store_buf_size = FRAME_BYTES * POOL_FRAMES,
+        .conv_frame_size = FRAME_BYTES,
+        .flags.flush_pool = 1, // on overflow drop the old frames, so the gap sits before what's pooled
+    };
+    ESP_ERROR_CHECK(adc_continuous_new_handle(&handle_cfg, &adc_handle));
+    ESP_ERROR_CHECK(stream_configure(stream_rate_hz, stream_range));
+
+    adc_continuous_evt_cbs_t cbs = {
+        .on_conv_done = conv_done_cb,
+        .on_pool_ovf = pool_ovf_cb,
+    };
+    ESP_ERROR_CHECK(adc_continuous_register_event_callbacks(adc_handle, &cbs, NULL));
+}
+
+static void stream_task(void *arg)
+{
+    static uint8_t frame[FRAME_BYTES];
+    static adc_block_t block;
+    static uint32_t drop_seen = 0;
+    static uint32_t ovf_seen = 0;
+    block_reset(&block);
+    stream_setup();
+    acq_rate_hz = stream_rate_hz;
+    acq_range = stream_range;
+    xSemaphoreGive((SemaphoreHandle_t)arg); // init can return
+
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        bool dropping = false;
+        uint32_t len = 0;
+        while (adc_continuous_read(adc_handle, frame, FRAME_BYTES, &len, 0) == ESP_OK) {
+            uint32_t req = atomic_load_explicit(&drop_req, memory_order_acquire);
+            if (drop_seen != req) {
+                // rate or range changing: the half built block and everything the driver still
+                // had pooled belong to the old settings. once the restart is through, take the
+                // new ones for the blocks that follow
+                drop_seen = req;
+                block_reset(&block);
+                dropping = true;
+                if (!(req & 1)) {
+                    acq_rate_hz = stream_rate_hz;
+                    acq_range = stream_range;
+                }
+            }
+            if (dropping || (req & 1)) { continue;}
+            if (ovf_seen != pool_ovf) {
+                // the pool was flushed: the half built block ends before the lost stretch.
+                // skip a block number so the consumer sees the gap
+                ovf_seen = pool_ovf;
+                block_reset(&block);
+                block_seq++;
+            }
+            // the newest conversion in the frame is about now, the rest sit one sample period apart
+            uint64_t now = adc_stream_timestamp_now();
+            uint32_t sig = len / (SOC_ADC_DIGI_RESULT_BYTES * PATTERN_LEN) * LANE_STRIDE;
+            demux_frame(frame, len, &block, now - samples_to_ticks(sig));
+        }
+    }
+}
+
+esp_err_t adc_stream_init(uint32_t rate_hz, adc_stream_block_cb_t cb, void *ctx)
+{
+    block_cb = cb;
+    block_ctx = ctx;
+
+    // scan pattern and the lane each converted channel goes to
+    for (int i = 0; i < 16; i++) { lane_of[i] = LANE_NONE;}
+    for (int c = 0; c < SCAN_LANES; c++) {
+        pattern_channels[c] = scope_channels[c];
+        lane_of[scope_channels[c]] = c;
+        lane_base[c] = ADC_STREAM_INTERLEAVE ? c : c * ADC_STREAM_BLOCK_SAMPLES;
+    }
+    pattern_channels[LANE_AUX_X] = ADC_JOY_X_CHANNEL;
+    pattern_channels[LANE_AUX_Y] = ADC_JOY_Y_CHANNEL;
+    lane_of[ADC_JOY_X_CHANNEL] = LANE_AUX_X;
+    lane_of[ADC_JOY_Y_CHANNEL] = LANE_AUX_Y;
+    if (ADC_STREAM_INTERLEAVE) {
+        // second path opposite the first: 0, X, 1, Y
+        pattern_channels[1] = ADC_JOY_X_CHANNEL;
+        pattern_channels[2] = scope_channels[1];
+    }
+    interleave_cal_reset(&ilv_cal);
+    cal_req++; // calibrate on the first blocks
+
+    gptimer_config_t timer_cfg = {
+        .clk_src = GPTIMER_CLK_SRC_DEFAULT,
+        .direction = GPTIMER_COUNT_UP,
+        .resolution_hz = TIMER_RESOLUTION_HZ,
+    };
+    ESP_ERROR_CHECK(gptimer_new_timer(&timer_cfg, &ts_timer));
+    ESP_ERROR_CHECK(gptimer_enable(ts_timer));
+    ESP_ERROR_CHECK(gptimer_start(ts_timer));
+
+    // the task brings the driver up itself (it exists before the ISR can notify it)
+    stream_rate_hz = clamp_rate(rate_hz);
+    adc_stream_reset_isr_interval();
+    SemaphoreHandle_t ready = xSemaphoreCreateBinary();
+    xTaskCreatePinnedToCore(stream_task, "adc_stream", 4096, ready, 5, &stream_task_handle, ACQ_CORE);
+    xSemaphoreTake(ready, portMAX_DELAY);
+    vSemaphoreDelete(ready);
+
+    ESP_LOGI(TAG, "stream ready @ %lu S/s (max %lu)", (unsigned long)stream_rate_hz,
+             (unsigned long)adc_stream_max_rate());
+    return ESP_OK;
+}
+
+esp_err_t adc_stream_start(void)
+{
+    if (running) { return ESP_OK;}
+    esp_err_t err = adc_continuous_start(adc_handle);
+    running = (err == ESP_OK);
+    return err;
+}
+
+esp_err_t adc_stream_stop(void)
+{
+    if (!running) { return ESP_OK;}
+    esp_err_t err = adc_continuous_stop(adc_handle);
+    running = false;
+    return err;
+}
+
+// the driver only takes a new configuration while stopped
+static esp_err_t stream_restart(uint32_t rate_hz, int range)
+{
+    bool was_running = running;
+    atomic_fetch_add(&drop_req, 1); // frames read from here on are dropped
+    adc_stream_stop();
+    esp_err_t err = stream_configure(rate_hz, range);
+    // and again for what the stop left in the pool, publishing the new settings to the stream task
+    atomic_fetch_add_explicit(&drop_req, 1, memory_order_release);
+    adc_stream_reset_isr_interval(); // the stop would show up as one long interval
+    if (was_running) {
+        adc_stream_start();
+    }
+    return err;
+}
+
+esp_err_t adc_stream_set_rate(uint32_t rate_hz)
+{
+    rate_hz = clamp_rate(rate_hz);
+    if (rate_hz == stream_rate_hz) { return ESP_OK;}
+    return stream_restart(rate_hz, stream_range);
+}
+
+esp_err_t adc_stream_set_range(int range)
+{
+    if (range < ADC_ATTEN_DB_0 || range > ADC_ATTEN_DB_12) { return ESP_ERR_INVALID_ARG;}
+    if (range == stream_range) { return ESP_OK;}
+    return stream_restart(stream_rate_hz, range);
+}
+
+int adc_stream_get_range(void)
+{
+    return stream_range;
+}
+
+uint32_t adc_stream_get_rate(void)
+{
+    return stream_rate_hz;
+}
+
+uint32_t adc_stream_max_rate(void)
+{
+    return SOC_ADC_SAMPLE_FREQ_THRES_HIGH * LANE_STRIDE / PATTERN_LEN;
+}
+
+uint32_t adc_stream_channel_skew(int ch)
+{
+    // one conversion slot per channel ahead of it in the pattern
+    return ((uint32_t)ch << ADC_STREAM_SKEW_FRAC_BITS) / PATTERN_LEN;
+}
+
+void adc_stream_calibrate_interleave(void)
+{
+    if (ADC_STREAM_INTERLEAVE) { cal_req++;}
+}
+
+void adc_stream_get_stats(adc_stream_stats_t *st)
+{
+    st->blocks = blocks_out;
+    st->pool_overflows = pool_ovf;
+    uint32_t lo = isr_min, hi = isr_max;
+    st->isr_interval_min_ns = (hi == 0) ? 0 : cycles_to_ns(lo);
+    st->isr_interval_max_ns = cycles_to_ns(hi);
+}
+
+void adc_stream_reset_isr_interval(void)
+{
+    // racing the interrupt on the other core costs at most one interval
+    isr_last = 0;
+    isr_min = UINT32_MAX;
+    isr_max = 0;
+#if ADC_STREAM_JITTER_HIST
+    isr_nominal = (uint32_t)((uint64_t)ADC_STREAM_BLOCK_SAMPLES * CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ * 1000000 / stream_rate_hz);
+    for (int b = 0; b < ADC_STREAM_JITTER_BUCKETS; b++) { isr_hist[b] = 0;}
+#endif
+}
+
+#if ADC_STREAM_JITTER_HIST
+// upper edge of the bucket the n-th smallest interval falls in, in cycles. the end buckets
+// are open, they answer with the exact min / max
+static uint32_t hist_percentile(const uint32_t *hist, uint32_t n)
+{
+    uint32_t seen = 0;
+    for (int b = 0; b < ADC_STREAM_JITTER_BUCKETS; b++) {
+        seen += hist[b];
+        if (seen < n) { continue;}
+        if (b == 0) { return isr_min;}
+        if (b == ADC_STREAM_JITTER_BUCKETS - 1) { break;}
+        uint32_t edge = isr_nominal + (int32_t)(b + 1 - ADC_STREAM_JITTER_BUCKETS / 2) * BUCKET_CYCLES;
+        return (edge < isr_max) ? edge : isr_max;
+    }
+    return isr_max;
+}
+#endif
+
+bool adc_stream_get_jitter(adc_stream_jitter_t *j)
+{
+#if ADC_STREAM_JITTER_HIST
+    // snapshot first, the interrupt keeps counting on the other core
+    uint32_t hist[ADC_STREAM_JITTER_BUCKETS];
+    uint32_t n = 0;
+    for (int b = 0; b < ADC_STREAM_JITTER_BUCKETS; b++) {
+        hist[b] = isr_hist[b];
+        n += hist[b];
+    }
+    if (n == 0) { return false;}
+    j->count = n;
+    j->nominal_ns = cycles_to_ns(isr_nominal);
+    j->p50_ns = cycles_to_ns(hist_percentile(hist, (n + 1) / 2));
+    j->p99_ns = cycles_to_ns(hist_percentile(hist, n - n / 100));
+    j->max_ns = cycles_to_ns(isr_max);
+    return true;
+#else
+    return false;
+#endif
+}
+
+uint64_t adc_stream_timestamp_now(void)
+{
+    uint64_t count = 0;
+    gptimer_get_raw_count(ts_timer, &count);
+    return count;
+}
+
+int adc_stream_get_aux(int idx)
+{
+    if (idx < 0 || idx >= ADC_STREAM_NUM_AUX) { return 0;}
+    return aux_raw[idx];
+}
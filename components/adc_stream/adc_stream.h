@@ -0,0 +1,120 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+#include "config.h"
+
+// DMA-driven (adc_continuous) acquisition of the signal channels.
+// conversions are collected by the driver without CPU involvement and handed
+// to the consumer in fixed size blocks from a single stream task. the signal
+// channels are converted one after the other in a scan pattern and demuxed into
+// one lane per channel. with ADC_STREAM_INTERLEAVE the first two channels are two paths
+// onto the same input, half a pattern apart, merged into one lane at twice the rate with
+// their offset / gain mismatch corrected.
+
+#define ADC_STREAM_BLOCK_SAMPLES    256     // signal samples per channel per block
+#define ADC_STREAM_MIN_RATE_HZ      10000   // slowest selectable signal rate
+#define ADC_STREAM_INTERLEAVE       SCOPE_INTERLEAVE
+#define ADC_STREAM_NUM_CHANNELS     (SCOPE_CHANNELS - ADC_STREAM_INTERLEAVE) // lanes in a block
+#define ADC_STREAM_NUM_AUX          2       // joystick X / Y ride along in the scan pattern
+#define ADC_STREAM_SKEW_FRAC_BITS   8       // channel skew is in 1/256 of a sample period
+#define ADC_STREAM_CAL_BLOCKS       64      // blocks in an interleave mismatch calibration
+#define ADC_STREAM_JITTER_HIST      ADC_JITTER_HIST
+#define ADC_STREAM_JITTER_BUCKETS   128     // frame interrupt interval histogram, centred on the nominal interval
+#define ADC_STREAM_JITTER_BUCKET_NS 1000    // bucket width. the end buckets take everything further out
+
+#if ADC_STREAM_INTERLEAVE && SCOPE_CHANNELS != 2
+#error "interleaving merges exactly two scanned inputs, set SCOPE_CHANNELS to 2"
+#endif
+
+// one block of raw 12 bit signal samples, a lane per channel
+typedef struct {
+    uint16_t count;         // samples per channel
+    uint64_t timestamp;     // timer count (TIMER_RESOLUTION_HZ) of samples[0][0]
+    uint32_t rate_hz;       // signal rate the block was sampled at
+    uint8_t range;          // input range (adc_atten_t of the signal channels) it was sampled at
+    uint32_t seq;           // block number. a jump means samples were lost before this block
+    uint16_t samples[ADC_STREAM_NUM_CHANNELS][ADC_STREAM_BLOCK_SAMPLES];
+} adc_block_t;
+
+// health counters, for checking a running unit
+typedef struct {
+    uint32_t blocks;            // blocks handed to the callback
+    uint32_t pool_overflows;    // times the driver's pool ran full and conversions were thrown away
+    uint32_t isr_interval_min_ns; // shortest / longest time between two DMA frame interrupts
+    uint32_t isr_interval_max_ns; // since adc_stream_reset_isr_interval(), 0 before two came in
+} adc_stream_stats_t;
+
+// frame interrupt intervals since the last reset, from the histogram. percentiles are
+// the upper edge of their bucket, so at most ADC_STREAM_JITTER_BUCKET_NS high
+typedef struct {
+    uint32_t count;         // intervals seen
+    uint32_t nominal_ns;    // what every one of them should be at the current rate
+    uint32_t p50_ns;
+    uint32_t p99_ns;
+    uint32_t max_ns;        // exact
+} adc_stream_jitter_t;
+
+// called from the stream task for every completed block. block is only valid during the call
+typedef void (*adc_stream_block_cb_t)(const adc_block_t *block, void *ctx);
+
+// creates the continuous driver and stream task. does not start sampling
+esp_err_t adc_stream_init(uint32_t rate_hz, adc_stream_block_cb_t cb, void *ctx);
+
+// start / stop the DMA conversions
+esp_err_t adc_stream_start(void);
+esp_err_t adc_stream_stop(void);
+
+// change the signal sample rate (clamped to [ADC_STREAM_MIN_RATE_HZ, adc_stream_max_rate()]).
+// blocks at the new rate start clean, nothing sampled before the change ends up in them
+esp_err_t adc_stream_set_rate(uint32_t rate_hz);
+
+// current signal sample rate in Hz
+uint32_t adc_stream_get_rate(void);
+
+// input range of the signal channels: the ADC attenuation (adc_atten_t), the joystick
+// stays at 12 dB. restarts the stream like a rate change
+esp_err_t adc_stream_set_range(int range);
+int adc_stream_get_range(void);
+
+// highest signal rate the hardware can deliver with the current scan pattern
+uint32_t adc_stream_max_rate(void);
+
+// how much later than channel 0 the scan converts channel ch, in 1 / 2^ADC_STREAM_SKEW_FRAC_BITS
+// of a sample period. sample i of every channel lands in the same block slot
+uint32_t adc_stream_channel_skew(int ch);
+
+// interleaved mode: estimates the mismatch between the two paths again over the next
+// ADC_STREAM_CAL_BLOCKS blocks, from whatever is on the input (anything not locked to
+// half the sample rate will do). runs once by itself after init. no-op otherwise
+void adc_stream_calibrate_interleave(void);
+
+void adc_stream_get_stats(adc_stream_stats_t *st);
+
+// starts the frame interrupt interval min / max and histogram over (the nominal interval
+// is ADC_STREAM_BLOCK_SAMPLES signal samples). rate and range changes do it too
+void adc_stream_reset_isr_interval(void);
+
+// p50 / p99 / max of the frame interrupt intervals. the interrupt is when a block's worth of
+// conversions is in and the stream task gets to timestamp it, so its jitter is what the
+// block timestamps carry. false without ADC_STREAM_JITTER_HIST or before two interrupts
+bool adc_stream_get_jitter(adc_stream_jitter_t *j);
+
+// latest raw reading of an aux channel (0 = joystick X, 1 = joystick Y)
+int adc_stream_get_aux(int idx);
+
+// free running timestamp clock the blocks are stamped with (TIMER_RESOLUTION_HZ ticks)
+uint64_t adc_stream_timestamp_now(void);
+
+#ifdef CONFIG_IDF_TARGET_LINUX
+// ---- host stand-in only ----
+
+// shape of the synthetic sine emitted by the host stream (amplitude in raw counts around midscale)
+void adc_stream_host_set_signal(uint32_t freq_hz, uint16_t amplitude);
+
+// realtime = pace blocks at the sample rate, otherwise emit them back to back for throughput runs
+void adc_stream_host_set_realtime(bool realtime);
+#endif
@@ -0,0 +1,224 @@
+#include "adc_stream.h"
+#include "config.h"
+#include "interleave.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <math.h>
+
+// linux stand-in for adc_stream.c. emits blocks of a synthetic sine (plus a bit of
+// noise) from a FreeRTOS task so the block consumers can run unchanged on the host.
+// channel c carries the c+1 th harmonic, sampled with the same scan skew as the target.
+// interleaved, the odd samples come through a second path with its own offset and gain
+// and get the same calibration and correction as on the target
+
+#define HOST_PATTERN_LEN    (SCOPE_CHANNELS + ADC_STREAM_NUM_AUX)
+#define HOST_LANE_STRIDE    (1 + ADC_STREAM_INTERLEAVE)
+#define HOST_MAX_RATE_HZ    (2000000 * HOST_LANE_STRIDE / HOST_PATTERN_LEN) // same limit as the scan pattern on target
+#define HOST_ILV_OFFSET     24      // raw codes the second interleave path reads high
+#define HOST_ILV_GAIN       1.03    // and its gain error
+#define HOST_NUM_RANGES     4       // attenuations, 0 / 2.5 / 6 / 12 dB
+#define HOST_MIDSCALE       2048
+#define HOST_NOISE_COUNTS   8
+
+static TaskHandle_t stream_task_handle;
+static adc_stream_block_cb_t block_cb;
+static void *block_ctx;
+static volatile uint32_t stream_rate_hz;
+static volatile bool running = false;
+static volatile bool realtime = true;
+static volatile uint32_t signal_freq_hz = 50;
+static volatile uint16_t signal_amplitude = 1500;
+static volatile int stream_range = HOST_NUM_RANGES - 1;
+// nominal gain of each range against 12 dB: the same pin voltage reads that many times the codes
+static const double range_gain[HOST_NUM_RANGES] = { 3.98, 2.99, 1.99, 1.0 };
+static volatile uint32_t block_seq = 0;
+static volatile uint64_t clock_ticks = 0;   // synthetic timestamp clock, runs on emitted samples
+static interleave_cal_t ilv_cal;
+static interleave_stats_t ilv_stats;
+static volatile uint32_t cal_req = 1;   // calibrate on the first blocks, like the target
+
+// cheap deterministic noise so runs are reproducible
+static uint32_t noise_state = 0x12345678;
+static int noise(void)
+{
+    noise_state = noise_state * 1664525u + 1013904223u;
+    return (int)(noise_state >> 24) % (2 * HOST_NOISE_COUNTS + 1) - HOST_NOISE_COUNTS;
+}
+
+static void fill_block(adc_block_t *block, double *phase)
+{
+    double step = 2.0 * M_PI * signal_freq_hz / stream_rate_hz;
+    for (int i = 0; i < ADC_STREAM_BLOCK_SAMPLES; i++) {
+        for (int c = 0; c < ADC_STREAM_NUM_CHANNELS; c++) {
+            double at = *phase + step * c / HOST_PATTERN_LEN;
+            double a = signal_amplitude * sin((c + 1) * at) / (c + 1);
+            int v = HOST_MIDSCALE + (int)a + noise();
+            if (ADC_STREAM_INTERLEAVE && (i & 1)) { v = HOST_MIDSCALE + HOST_ILV_OFFSET + (int)(a * HOST_ILV_GAIN) + noise();}
+            v = (int)(v * range_gain[stream_range]);
+            if (v < 0) { v = 0;}
+            if (v > 4095) { v = 4095;}
+            block->samples[c][i] = v;
+        }
+        *phase += step;
+        if (*phase >= 2.0 * M_PI) { *phase -= 2.0 * M_PI;}
+    }
+    block->count = ADC_STREAM_BLOCK_SAMPLES;
+}
+
+// same as the target: calibration sums from the raw pairs, then the correction
+static void interleave_block(adc_block_t *block)
+{
+    static uint32_t cal_seen = 0;
+    static uint32_t cal_left = 0;
+    if (cal_seen != cal_req) {
+        cal_seen = cal_req;
+        interleave_stats_reset(&ilv_stats);
+        cal_left = ADC_STREAM_CAL_BLOCKS;
+    }
+    if (cal_left > 0) {
+        interleave_stats_add(&ilv_stats, block->samples[0], block->count);
+        if (--cal_left == 0) { interleave_cal_estimate(&ilv_stats, &ilv_cal);}
+    }
+    interleave_correct(&ilv_cal, block->samples[0], block->count);
+}
+
+static void stream_task(void *arg)
+{
+    static adc_block_t block;
+    double phase = 0.0;
+    double owed_us = 0.0;
+
+    while (1) {
+        if (!running) {
+            vTaskDelay(pdMS_TO_TICKS(10));
+            continue;
+        }
+        fill_block(&block, &phase);
+        if (ADC_STREAM_INTERLEAVE) { interleave_block(&block);}
+        block.timestamp = clock_ticks;
+        block.rate_hz = stream_rate_hz;
+        block.range = stream_range;
+        block.seq = block_seq++;
+        clock_ticks += (uint64_t)block.count * TIMER_RESOLUTION_HZ / stream_rate_hz;
+        block_cb(&block, block_ctx);
+
+        if (realtime) {
+            // sleep off whole ticks worth of block time, carry the remainder
+            owed_us += 1e6 * ADC_STREAM_BLOCK_SAMPLES / stream_rate_hz;
+            TickType_t ticks = (TickType_t)(owed_us / (1000.0 * portTICK_PERIOD_MS));
+            if (ticks > 0) {
+                owed_us -= ticks * 1000.0 * portTICK_PERIOD_MS;
+                vTaskDelay(ticks);
+            }
+        } else {
+            taskYIELD();
+        }
+    }
+}
+
+static uint32_t clamp_rate(uint32_t rate_hz)
+{
+    if (rate_hz < ADC_STREAM_MIN_RATE_HZ) { rate_hz = ADC_STREAM_MIN_RATE_HZ;}
+    if (rate_hz > HOST_MAX_RATE_HZ) { rate_hz = HOST_MAX_RATE_HZ;}
+    return rate_hz;
+}
+
+esp_err_t adc_stream_init(uint32_t rate_hz, adc_stream_block_cb_t cb, void *ctx)
+{
+    block_cb = cb;
+    block_ctx = ctx;
+    stream_rate_hz = clamp_rate(rate_hz);
+    interleave_cal_reset(&ilv_cal);
+    xTaskCreate(stream_task, "adc_stream", 4096, NULL, 5, &stream_task_handle);
+    return ESP_OK;
+}
+
+esp_err_t adc_stream_start(void)
+{
+    running = true;
+    return ESP_OK;
+}
+
+esp_err_t adc_stream_stop(void)
+{
+    running = false;
+    return ESP_OK;
+}
+
+esp_err_t adc_stream_set_rate(uint32_t rate_hz)
+{
+    stream_rate_hz = clamp_rate(rate_hz);
+    return ESP_OK;
+}
+
+uint32_t adc_stream_get_rate(void)
+{
+    return stream_rate_hz;
+}
+
+esp_err_t adc_stream_set_range(int range)
+{
+    if (range < 0 || range >= HOST_NUM_RANGES) { return ESP_ERR_INVALID_ARG;}
+    stream_range = range;
+    return ESP_OK;
+}
+
+int adc_stream_get_range(void)
+{
+    return stream_range;
+}
+
+uint32_t adc_stream_max_rate(void)
+{
+    return HOST_MAX_RATE_HZ;
+}
+
+uint32_t adc_stream_channel_skew(int ch)
+{
+    return ((uint32_t)ch << ADC_STREAM_SKEW_FRAC_BITS) / HOST_PATTERN_LEN;
+}
+
+void adc_stream_calibrate_interleave(void)
+{
+    if (ADC_STREAM_INTERLEAVE) { cal_req++;}
+}
+
+void adc_stream_get_stats(adc_stream_stats_t *st)
+{
+    st->blocks = block_seq;
+    st->pool_overflows = 0; // nothing to overflow on the host
+    st->isr_interval_min_ns = 0; // and no interrupt to time
+    st->isr_interval_max_ns = 0;
+}
+
+void adc_stream_reset_isr_interval(void)
+{
+}
+
+bool adc_stream_get_jitter(adc_stream_jitter_t *j)
+{
+    (void)j;
+    return false;
+}
+
+uint64_t adc_stream_timestamp_now(void)
+{
+    return clock_ticks;
+}
+
+int adc_stream_get_aux(int idx)
+{
+    (void)idx;
+    return HOST_MIDSCALE; // joystick parked in the middle
+}
+
+void adc_stream_host_set_signal(uint32_t freq_hz, uint16_t amplitude)
+{
+    signal_freq_hz = freq_hz;
+    signal_amplitude = amplitude;
+}
+
+void adc_stream_host_set_realtime(bool rt)
+{
+    realtime = rt;
+}
@@ -0,0 +1,108 @@
+#include "adc_stream.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "host_test.h"
+#include <stdatomic.h>
+
+// the host stand-in hands out numbered, stamped blocks of the synthetic sine
+// the same way the target stream does, and follows rate / range changes
+
+#define BLOCKS  64
+
+typedef struct {
+    uint32_t seq;
+    uint64_t timestamp;
+    uint32_t rate_hz;
+    uint8_t range;
+    uint16_t count;
+    uint16_t lo, hi;
+} seen_t;
+
+static seen_t seen[BLOCKS];
+static atomic_uint n_seen;
+
+static void on_block(const adc_block_t *block, void *ctx)
+{
+    uint32_t n = atomic_load(&n_seen);
+    if (n >= BLOCKS) { return;}
+    seen_t *s = &seen[n];
+    s->seq = block->seq;
+    s->timestamp = block->timestamp;
+    s->rate_hz = block->rate_hz;
+    s->range = block->range;
+    s->count = block->count;
+    s->lo = 4095;
+    s->hi = 0;
+    for (int c = 0; c < ADC_STREAM_NUM_CHANNELS; c++) {
+        for (int i = 0; i < block->count; i++) {
+            if (block->samples[c][i] < s->lo) { s->lo = block->samples[c][i];}
+            if (block->samples[c][i] > s->hi) { s->hi = block->samples[c][i];}
+        }
+    }
+    atomic_store(&n_seen, n + 1);
+}
+
+// runs the stream until BLOCKS blocks came in
+static void collect(void)
+{
+    atomic_store(&n_seen, 0);
+    adc_stream_start();
+    while (atomic_load(&n_seen) < BLOCKS) { vTaskDelay(1);}
+    adc_stream_stop();
+    vTaskDelay(pdMS_TO_TICKS(20)); // let the stream task park
+}
+
+// seq runs without gaps, timestamps advance by exactly the samples in between
+static void check_run(uint32_t rate_hz, int range)
+{
+    for (int b = 0; b < BLOCKS; b++) {
+        CHECK(seen[b].count == ADC_STREAM_BLOCK_SAMPLES);
+        CHECK(seen[b].rate_hz == rate_hz);
+        CHECK(seen[b].range == range);
+        CHECK(seen[b].hi <= 4095);
+        if (b > 0) {
+            CHECK(seen[b].seq == seen[b - 1].seq + 1);
+            uint64_t dt = seen[b].timestamp - seen[b - 1].timestamp;
+            CHECK(dt == (uint64_t)ADC_STREAM_BLOCK_SAMPLES * TIMER_RESOLUTION_HZ / rate_hz);
+        }
+    }
+}
+
+int main(void)
+{
+    adc_stream_host_set_realtime(false);
+    adc_stream_host_set_signal(1000, 1500);
+    CHECK(adc_stream_init(100000, on_block, NULL) == ESP_OK);
+    CHECK(adc_stream_get_rate() == 100000);
+
+    // clamped into [ADC_STREAM_MIN_RATE_HZ, max]
+    adc_stream_set_rate(1);
+    CHECK(adc_stream_get_rate() == ADC_STREAM_MIN_RATE_HZ);
+    adc_stream_set_rate(0xffffffffu);
+    CHECK(adc_stream_get_rate() == adc_stream_max_rate());
+    CHECK(adc_stream_set_range(-1) == ESP_ERR_INVALID_ARG);
+    CHECK(adc_stream_set_range(4) == ESP_ERR_INVALID_ARG);
+
+    adc_stream_set_rate(100000);
+    collect();
+    check_run(100000, 3);
+    // a 1500 count sine around midscale, plus the noise
+    CHECK(seen[BLOCKS - 1].lo < 2048 - 1400 && seen[BLOCKS - 1].hi > 2048 + 1400);
+
+    // new rate and range show up in the blocks, numbering carries on
+    uint32_t last_seq = seen[BLOCKS - 1].seq;
+    adc_stream_set_rate(40000);
+    adc_stream_set_range(2);
+    collect();
+    check_run(40000, 2);
+    CHECK(seen[0].seq > last_seq);
+    // 6 dB reads the same pin voltage as about twice the codes, the top of the sine clips
+    CHECK(seen[BLOCKS - 1].hi == 4095);
+
+    adc_stream_stats_t st;
+    adc_stream_get_stats(&st);
+    CHECK(st.blocks >= 2 * BLOCKS);
+    CHECK(st.pool_overflows == 0);
+    CHECK(adc_stream_channel_skew(0) == 0);
+    return HOST_TEST_RESULT();
+}
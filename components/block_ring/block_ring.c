@@ -0,0 +1,89 @@
+#include "block_ring.h"
+#include <stddef.h>
+#include <string.h>
+
+#define RING_MASK (BLOCK_RING_SLOTS - 1)
+
+_Static_assert((BLOCK_RING_SLOTS & RING_MASK) == 0, "BLOCK_RING_SLOTS must be a power of two");
+
+// indices run freely and wrap at 2^32, head - tail is always the fill level
+
+void block_ring_init(block_ring_t *ring)
+{
+    atomic_store_explicit(&ring->head, 0, memory_order_relaxed);
+    atomic_store_explicit(&ring->tail, 0, memory_order_relaxed);
+    atomic_store_explicit(&ring->overrun_blocks, 0, memory_order_relaxed);
+    atomic_store_explicit(&ring->overrun_samples, 0, memory_order_relaxed);
+    ring->tail_cache = 0;
+    ring->head_cache = 0;
+    atomic_thread_fence(memory_order_seq_cst);
+}
+
+adc_block_t *block_ring_write_slot(block_ring_t *ring, uint16_t n_samples)
+{
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    if (head - ring->tail_cache >= BLOCK_RING_SLOTS) {
+        // looks full from the cached tail, go fetch the real one (acquire pairs with release)
+        ring->tail_cache = atomic_load_explicit(&ring->tail, memory_order_acquire);
+        if (head - ring->tail_cache >= BLOCK_RING_SLOTS) {
+            atomic_fetch_add_explicit(&ring->overrun_blocks, 1, memory_order_relaxed);
+            atomic_fetch_add_explicit(&ring->overrun_samples, n_samples, memory_order_relaxed);
+            return NULL;
+        }
+    }
+    return &ring->slots[head & RING_MASK];
+}
+
+void block_ring_commit(block_ring_t *ring)
+{
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    // release: slot contents become visible before the new head
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+}
+
+bool block_ring_push(block_ring_t *ring, const adc_block_t *block)
+{
+    adc_block_t *slot = block_ring_write_slot(ring, block->count);
+    if (slot == NULL) { return false;}
+    // the whole header (count, timestamp, rate, range...), then only the filled samples
+    memcpy(slot, block, offsetof(adc_block_t, samples));
+    for (int c = 0; c < ADC_STREAM_NUM_CHANNELS; c++) {
+        memcpy(slot->samples[c], block->samples[c], block->count * sizeof(block->samples[c][0]));
+    }
+    block_ring_commit(ring);
+    return true;
+}
+
+const adc_block_t *block_ring_peek(block_ring_t *ring)
+{
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    if (tail == ring->head_cache) {
+        ring->head_cache = atomic_load_explicit(&ring->head, memory_order_acquire);
+        if (tail == ring->head_cache) { return NULL;}
+    }
+    return &ring->slots[tail & RING_MASK];
+}
+
+void block_ring_release(block_ring_t *ring)
+{
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    // release: we are done reading the slot before the producer may reuse it
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+}
+
+uint32_t block_ring_count(block_ring_t *ring)
+{
+    uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    return head - tail;
+}
+
+uint32_t block_ring_overrun_blocks(block_ring_t *ring)
+{
+    return atomic_load_explicit(&ring->overrun_blocks, memory_order_relaxed);
+}
+
+uint32_t block_ring_overrun_samples(block_ring_t *ring)
+{
+    return atomic_load_explicit(&ring->overrun_samples, memory_order_relaxed);
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "adc_stream.h"
+#include "sdkconfig.h"
+
+// Lock-free single producer / single consumer ring of adc blocks.
+// the producer (adc_stream task) and consumer (adc_sample_task) may sit on
+// different cores: head/tail are C11 atomics with release/acquire ordering and
+// each side's index lives on its own cache line so they don't false share.
+
+#define BLOCK_RING_SLOTS    16  // must be a power of two
+
+#ifdef CONFIG_IDF_TARGET_LINUX
+#define BLOCK_RING_CACHE_LINE   64
+#else
+#define BLOCK_RING_CACHE_LINE   32  // ESP32 cache line
+#endif
+
+typedef struct {
+    // producer side
+    _Alignas(BLOCK_RING_CACHE_LINE) atomic_uint head;
+    uint32_t tail_cache;            // producer's last view of tail
+    atomic_uint overrun_blocks;     // blocks dropped because the ring was full
+    atomic_uint overrun_samples;
+
+    // consumer side
+    _Alignas(BLOCK_RING_CACHE_LINE) atomic_uint tail;
+    uint32_t head_cache;            // consumer's last view of head
+
+    _Alignas(BLOCK_RING_CACHE_LINE) adc_block_t slots[BLOCK_RING_SLOTS];
+} block_ring_t;
+
+// resets indices and overrun counters
+void block_ring_init(block_ring_t *ring);
+
+// ---- producer ----
+
+// next free slot to fill in place, or NULL if full (counted as an overrun of n_samples)
+adc_block_t *block_ring_write_slot(block_ring_t *ring, uint16_t n_samples);
+
+// publishes the slot returned by block_ring_write_slot
+void block_ring_commit(block_ring_t *ring);
+
+// copies a whole block in. returns false (and counts the overrun) if the ring is full
+bool block_ring_push(block_ring_t *ring, const adc_block_t *block);
+
+// ---- consumer ----
+
+// oldest filled block without copying, or NULL if empty. valid until block_ring_release
+const adc_block_t *block_ring_peek(block_ring_t *ring);
+
+// hands the peeked block's slot back to the producer
+void block_ring_release(block_ring_t *ring);
+
+// ---- either side ----
+
+// filled blocks currently waiting
+uint32_t block_ring_count(block_ring_t *ring);
+
+// total blocks / samples dropped because the consumer fell behind
+uint32_t block_ring_overrun_blocks(block_ring_t *ring);
+uint32_t block_ring_overrun_samples(block_ring_t *ring);
@@ -0,0 +1,246 @@
+#include "block_ring.h"
+#include "adc_stream.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "host_test.h"
+#include <stdatomic.h>
+#include <string.h>
+#include <time.h>
+
+// block ring against the per-sample queue it replaced, both fed by the host adc_stream.
+// ring: the stream callback pushes the block and notifies the consumer, which peeks and
+// releases whole blocks (main.c). queue: the callback sends every channel 0 sample into a
+// 1024 x uint16_t queue and the consumer receives them one by one (the old timer ISR and
+// adc_sample_task, xQueueSendFromISR never blocks so a full queue drops the sample).
+//
+// throughput: stream runs flat out, samples/s are what reached the consumer.
+// latency: stream paced at LATENCY_RATE_HZ. handoff latency is from the callback getting a
+// block to the consumer holding all of its samples
+
+#define QUEUE_LENGTH        1024            // ADC_QUEUE_LENGTH of the queue design
+#define THROUGHPUT_MS       500
+#define LATENCY_RATE_HZ     100000          // 10x the old timer ISR, one block every 2.56 ms
+#define LATENCY_MS          2000
+#define STAMPS              1024            // block arrival times kept, indexed by seq
+#define LAT_BUCKET_NS       1000            // latency histogram, 1 us buckets
+#define LAT_BUCKETS         20000           // everything past 20 ms lands in the last one
+#define SAMPLE_STORE        4096            // consumer's circular buffer (adc_buff)
+
+enum { MODE_IDLE, MODE_GENERATOR, MODE_RING, MODE_QUEUE };
+
+static const char *mode_name[] = { "", "generator only", "block ring", "sample queue" };
+
+static block_ring_t ring;
+static QueueHandle_t queue;
+static TaskHandle_t consumer;
+static atomic_int mode = MODE_IDLE;
+static atomic_bool measure_latency;
+
+// producer side
+static uint64_t stamp_ns[STAMPS];
+static atomic_ullong produced;          // channel 0 samples offered
+static atomic_ullong queue_drops;
+static uint64_t produced_sum;           // of everything the queue accepted, for the integrity check
+
+// consumer side
+static atomic_ullong consumed;
+static uint64_t consumed_sum;
+static uint16_t store[SAMPLE_STORE];
+static uint32_t store_at;
+static uint32_t lat_hist[LAT_BUCKETS];
+static uint64_t lat_max_ns;
+static uint32_t lat_count;
+static uint32_t next_seq;
+static uint32_t seq_jumps;
+static _Atomic uint64_t last_consumed_ns;
+
+static uint64_t now_ns(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000ull + t.tv_nsec;
+}
+
+static void record_latency(uint32_t seq)
+{
+    if (!atomic_load_explicit(&measure_latency, memory_order_relaxed)) { return;}
+    uint64_t ns = now_ns() - stamp_ns[seq % STAMPS];
+    uint32_t b = ns / LAT_BUCKET_NS;
+    lat_hist[b < LAT_BUCKETS ? b : LAT_BUCKETS - 1]++;
+    if (ns > lat_max_ns) { lat_max_ns = ns;}
+    lat_count++;
+}
+
+// upper edge of the bucket holding the pct'th percentile
+static uint64_t latency_percentile(uint32_t pct)
+{
+    uint64_t want = ((uint64_t)lat_count * pct + 99) / 100;
+    uint64_t seen = 0;
+    for (uint32_t b = 0; b < LAT_BUCKETS; b++) {
+        seen += lat_hist[b];
+        if (seen >= want) { return (uint64_t)(b + 1) * LAT_BUCKET_NS;}
+    }
+    return lat_max_ns;
+}
+
+static void on_block(const adc_block_t *block, void *ctx)
+{
+    stamp_ns[block->seq % STAMPS] = now_ns();
+    atomic_fetch_add_explicit(&produced, block->count, memory_order_relaxed);
+    switch (atomic_load_explicit(&mode, memory_order_relaxed)) {
+    case MODE_RING:
+        if (block_ring_push(&ring, block)) { xTaskNotifyGive(consumer);}
+        break;
+    case MODE_QUEUE:
+        for (int i = 0; i < block->count; i++) {
+            BaseType_t hp = pdFALSE;
+            if (xQueueSendFromISR(queue, &block->samples[0][i], &hp) == pdPASS) {
+                produced_sum += block->samples[0][i];
+            } else {
+                atomic_fetch_add_explicit(&queue_drops, 1, memory_order_relaxed);
+            }
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+static void consumer_task(void *arg)
+{
+    uint32_t in_block = 0;  // queue: samples received of the current block
+    while (1) {
+        if (atomic_load_explicit(&mode, memory_order_relaxed) == MODE_QUEUE) {
+            uint16_t val;
+            if (!xQueueReceive(queue, &val, pdMS_TO_TICKS(10))) { continue;}
+            store[store_at] = val;
+            store_at = (store_at + 1) % SAMPLE_STORE;
+            consumed_sum += val;
+            atomic_fetch_add_explicit(&consumed, 1, memory_order_relaxed);
+            atomic_store_explicit(&last_consumed_ns, now_ns(), memory_order_relaxed);
+            // only exact while nothing is dropped, which the latency run checks
+            if (++in_block == ADC_STREAM_BLOCK_SAMPLES) {
+                in_block = 0;
+                record_latency(next_seq++);
+            }
+            continue;
+        }
+        in_block = 0;
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(10));
+        const adc_block_t *block;
+        while ((block = block_ring_peek(&ring)) != NULL) {
+            record_latency(block->seq);
+            if (block->seq != next_seq) { seq_jumps++;}
+            next_seq = block->seq + 1;
+            for (int i = 0; i < block->count; i++) {
+                store[store_at] = block->samples[0][i];
+                store_at = (store_at + 1) % SAMPLE_STORE;
+            }
+            atomic_fetch_add_explicit(&consumed, block->count, memory_order_relaxed);
+            atomic_store_explicit(&last_consumed_ns, now_ns(), memory_order_relaxed);
+            block_ring_release(&ring);
+        }
+    }
+}
+
+// lets the consumer finish whatever is still in flight
+static void drain(void)
+{
+    uint64_t last;
+    do {
+        last = atomic_load(&consumed);
+        vTaskDelay(pdMS_TO_TICKS(20));
+    } while (atomic_load(&consumed) != last);
+}
+
+static void reset_counters(void)
+{
+    atomic_store(&produced, 0);
+    atomic_store(&consumed, 0);
+    atomic_store(&queue_drops, 0);
+    produced_sum = 0;
+    consumed_sum = 0;
+    memset(lat_hist, 0, sizeof(lat_hist));
+    lat_max_ns = 0;
+    lat_count = 0;
+    seq_jumps = 0;
+    block_ring_init(&ring);
+}
+
+// one run of the stream through the given handoff. returns delivered samples per second
+static double run(int m, bool paced, uint32_t ms)
+{
+    adc_stream_host_set_realtime(paced);
+    adc_stream_set_rate(paced ? LATENCY_RATE_HZ : adc_stream_max_rate());
+    reset_counters();
+    atomic_store(&measure_latency, paced);
+    atomic_store(&mode, m);
+    // the consumer's idea of the next block: the stream is stopped, so it's the next one numbered
+    // (the stand-in never skips a number, so that's the count handed out so far)
+    adc_stream_stats_t st;
+    adc_stream_get_stats(&st);
+    next_seq = st.blocks;
+
+    uint64_t t0 = now_ns();
+    adc_stream_start();
+    vTaskDelay(pdMS_TO_TICKS(ms));
+    adc_stream_stop();
+    uint64_t stop = now_ns();
+    if (m != MODE_GENERATOR) { drain();}
+    uint64_t n = m == MODE_GENERATOR ? atomic_load(&produced) : atomic_load(&consumed);
+    // samples still arriving after the stop count, but so does the time they took
+    uint64_t elapsed = (m == MODE_GENERATOR ? stop : atomic_load(&last_consumed_ns)) - t0;
+    atomic_store(&mode, MODE_IDLE);
+    return n * 1e9 / elapsed;
+}
+
+static void report_throughput(int m, double rate)
+{
+    uint64_t p = atomic_load(&produced);
+    uint64_t dropped = m == MODE_RING ? (uint64_t)block_ring_overrun_samples(&ring) :
+                       m == MODE_QUEUE ? atomic_load(&queue_drops) : 0;
+    printf("  %-15s %8.2f MS/s delivered  (%5.1f%% of %llu offered dropped)\n", mode_name[m],
+           rate / 1e6, p ? 100.0 * dropped / p : 0.0, (unsigned long long)p);
+}
+
+static void report_latency(int m)
+{
+    uint64_t dropped = m == MODE_RING ? (uint64_t)block_ring_overrun_samples(&ring) : atomic_load(&queue_drops);
+    printf("  %-15s %6u blocks  p50 %6.1f us  p99 %7.1f us  max %8.1f us  dropped %llu\n",
+           mode_name[m], lat_count, latency_percentile(50) / 1e3, latency_percentile(99) / 1e3,
+           lat_max_ns / 1e3, (unsigned long long)dropped);
+}
+
+int main(void)
+{
+    queue = xQueueCreate(QUEUE_LENGTH, sizeof(uint16_t));
+    xTaskCreate(consumer_task, "adc_task", 4096, NULL, 3, &consumer);
+    adc_stream_host_set_signal(1000, 1500);
+    adc_stream_init(LATENCY_RATE_HZ, on_block, NULL);
+
+    printf("throughput, stream flat out, %d ms each, channel 0 samples\n", THROUGHPUT_MS);
+    double gen = run(MODE_GENERATOR, false, THROUGHPUT_MS);
+    report_throughput(MODE_GENERATOR, gen);
+    double r = run(MODE_RING, false, THROUGHPUT_MS);
+    report_throughput(MODE_RING, r);
+    CHECK(seq_jumps == 0 || block_ring_overrun_blocks(&ring) > 0);
+    double q = run(MODE_QUEUE, false, THROUGHPUT_MS);
+    report_throughput(MODE_QUEUE, q);
+    // everything the queue took in came out, in one piece
+    CHECK(consumed_sum == produced_sum);
+    printf("  ring / queue    %8.1fx\n", r / q);
+
+    printf("handoff latency at %d kS/s, %d ms each\n", LATENCY_RATE_HZ / 1000, LATENCY_MS);
+    run(MODE_RING, true, LATENCY_MS);
+    report_latency(MODE_RING);
+    // the ring keeps up with a paced stream: every block arrives, in order
+    CHECK(block_ring_overrun_blocks(&ring) == 0);
+    CHECK(seq_jumps == 0);
+    CHECK(lat_count > 0);
+    run(MODE_QUEUE, true, LATENCY_MS);
+    report_latency(MODE_QUEUE);
+    CHECK(consumed_sum == produced_sum);
+    if (atomic_load(&queue_drops)) { printf("  (queue dropped samples, its block boundaries and latency are approximate)\n");}
+    return HOST_TEST_RESULT();
+}
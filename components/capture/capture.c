@@ -0,0 +1,904 @@
+#include "capture.h"
+#include "trigger.h"
+#include <stdatomic.h>
+#include <string.h>
+
+// frame ownership. only these transitions happen:
+//   writer: FREE -> WRITING, WRITING -> READY, READY -> FREE (a newer record replaces it)
+//   reader: READY -> READING, READING -> FREE
+// so there is never more than one READY frame
+typedef enum {
+    FRAME_FREE,
+    FRAME_WRITING,
+    FRAME_READY,
+    FRAME_READING,
+} frame_owner_t;
+
+// single store replacing the old adc_buff + sample_buffer pair, carved into the frames
+// (or, in segmented mode, into up to CAPTURE_MAX_SEGMENTS equal segments). the
+// averaging accumulator borrows a frame as int32 through the union
+static union {
+    uint16_t samples[CAPTURE_STORE_SAMPLES];
+    int32_t wide[CAPTURE_STORE_SAMPLES / 2];
+} store;
+static capture_frame_t frames[CAPTURE_NUM_FRAMES];
+static atomic_int owner[CAPTURE_NUM_FRAMES];
+static capture_frame_t segs[CAPTURE_MAX_SEGMENTS];
+static atomic_uint seg_done;    // segments complete, release ordered against their samples
+static atomic_uint seg_total;   // segments in the running segmented acquisition
+static atomic_uint seg_gen;     // arm request the current segments belong to
+
+// requests from the UI side, picked up by the writer
+static atomic_uint req_record_len;
+static atomic_uint req_pre_len;
+static atomic_uint req_holdoff;
+static atomic_int req_mode = CAPTURE_MODE_AUTO;
+static atomic_uint req_single_gen = 0;  // bumped per single shot / segmented arm
+static atomic_uint req_segments = CAPTURE_MAX_SEGMENTS;
+static atomic_uint req_rate_hz = 1;
+static atomic_uint req_avg_count = 1;   // 1 = averaging off
+static atomic_int req_avg_kind = CAPTURE_AVG_EXPONENTIAL;
+static atomic_uint req_avg_gen = 0;     // bumped whenever the averaging settings change
+static atomic_uint req_frac_bits = 0;
+static atomic_uint req_skew[CAPTURE_MAX_CHANNELS];
+static atomic_uint req_range;
+static atomic_uint req_code_scale = 1u << 16;
+
+// ---- writer (adc_sample_task) state ----
+static volatile capture_state_t state;
+static int acq_frame = -1;      // frame being written
+static uint16_t *acq_buf;
+static uint32_t record_len;     // ring length inside the frame while pre-triggering
+static uint32_t pre_len;
+static uint32_t wr;             // write position inside the record ring
+static uint32_t filled;         // valid samples in the record ring (saturates at record_len)
+static uint32_t post_left;
+static uint32_t holdoff_left;   // samples until a new trigger may be accepted
+static uint32_t auto_left;      // auto mode: samples left before a record is forced
+static bool forced;
+static uint16_t trig_frac;      // sub-sample crossing position of the current record
+static uint32_t frame_seq = 0;
+static uint32_t single_gen = 0;         // last arm request the writer acted on
+static uint64_t trig_time;      // timestamp of the trigger sample
+static bool live;               // trigger has been scanning in this record
+static uint64_t record_end;     // sample clock at the end of the last record (or the arm)
+static uint32_t rearm_lat;      // samples from record_end until the trigger went live
+static uint32_t frac_bits = 0;  // extra bits below the 12 bit code in the incoming samples
+static uint32_t rate_hz = 1;    // sample rate of the incoming samples
+static uint32_t range = 0;      // input range of the incoming samples
+static uint32_t num_ch = 1;     // channels per record
+static uint32_t lane_len;       // distance between the channel lanes of the record
+
+// sample clock: samples fed in so far, and where the current block sits on it
+static uint64_t fed = 0;
+static uint64_t wr_clock;       // clock of the next sample ring_write() takes
+
+// recent gaps on the sample clock: the first sample after each
+#define GAP_HIST    8           // power of two
+static uint64_t gap_clock[GAP_HIST];
+static atomic_uint gap_count;
+static atomic_uint lost_samples;
+static bool losing;             // samples have been dropped since the last record
+static const uint16_t *blk_ptr;
+static const uint16_t *blk_chan[CAPTURE_MAX_CHANNELS]; // every channel's current block, blk_chan[0] == blk_ptr
+static uint64_t blk_clock;
+static uint64_t blk_time;       // timestamp of the first sample of the current block
+
+// segmented acquisition, only while the writer owns every frame
+static bool seg_active = false;
+static uint32_t seg_len;
+static uint32_t seg_pre;
+
+// averaging, only while the writer owns a frame for the accumulator
+#define AVG_FRAC_BITS   8       // exponential accumulator is Q(12 + AVG_FRAC_BITS)
+static bool avg_active = false;
+static int avg_frame = -1;      // frame holding the accumulator
+static int32_t *avg_acc;        // one wide sum per record sample, CAPTURE_AVG_MAX_SAMPLES at most
+static uint32_t avg_n;          // records per average (exponential: rounded down to a power of two)
+static uint32_t avg_shift;      // log2(avg_n) for exponential
+static capture_avg_t avg_kind;
+static uint32_t avg_count;      // records in the accumulator so far
+static uint32_t avg_len;        // record shape the accumulator belongs to
+static uint32_t avg_gen;
+static bool avg_have_block;     // block averaging: one full block has been shown
+static uint32_t avg_frac;       // trigger_frac, accumulated like the samples
+
+// ---- reader (display) state ----
+static int held_frame = -1;
+
+static uint64_t clock_at(const uint16_t *p)
+{
+    return blk_clock + (uint64_t)(p - blk_ptr);
+}
+
+static bool cas_owner(int f, int from, int to)
+{
+    return atomic_compare_exchange_strong_explicit(&owner[f], &from, to,
+                                                   memory_order_acq_rel, memory_order_relaxed);
+}
+
+// copy into the record ring, every channel from the same spot in its block
+static void ring_write(const uint16_t *samples, size_t n)
+{
+    size_t off = samples - blk_ptr;
+    wr_clock = blk_clock + off + n;
+    while (n > 0) {
+        size_t run = record_len - wr;
+        if (run > n) { run = n;}
+        for (uint32_t c = 0; c < num_ch; c++) {
+            memcpy(&acq_buf[c * lane_len + wr], blk_chan[c] + off, run * sizeof(samples[0]));
+        }
+        wr += run;
+        if (wr == record_len) { wr = 0;}
+        filled += run;
+        if (filled > record_len) { filled = record_len;}
+        off += run;
+        n -= run;
+    }
+}
+
+// start the record in the current frame over
+static void restart_record(void)
+{
+    wr = 0;
+    filled = 0;
+    auto_left = record_len;
+    forced = false;
+    trig_frac = 0;
+    live = false;
+    trigger_reset();
+    state = CAPTURE_ARMED;
+}
+
+// point the writer at buf (channel 0's lane, the others follow every lane_len) and reset
+// the record. with carry set, the tail of the record that just finished seeds the
+// pre-trigger history, so the trigger is live again right away instead of after pre_len
+// fresh samples (the blind time between records)
+static void start_record(uint16_t *buf, uint32_t new_len, uint32_t new_pre, bool carry)
+{
+    if (new_len > lane_len) { new_len = lane_len;}
+    if (new_pre >= new_len) { new_pre = new_len - 1;}
+    carry = carry && acq_buf != NULL && new_len == record_len && new_pre <= record_len;
+
+    const uint16_t *prev = acq_buf;
+    uint32_t prev_wr = wr;
+
+    acq_buf = buf;
+    record_len = new_len;
+    pre_len = new_pre;
+    restart_record();
+
+    if (carry) {
+        // newest pre_len samples of the old ring, in order, as the start of the new one
+        uint32_t from = (prev_wr + record_len - pre_len) % record_len;
+        uint32_t first = record_len - from;
+        if (first > pre_len) { first = pre_len;}
+        for (uint32_t c = 0; c < num_ch; c++) {
+            const uint16_t *src = prev + c * lane_len;
+            uint16_t *dst = acq_buf + c * lane_len;
+            memcpy(dst, &src[from], first * sizeof(src[0]));
+            memcpy(&dst[first], src, (pre_len - first) * sizeof(src[0]));
+        }
+        wr = pre_len % record_len;
+        filled = pre_len;
+    }
+}
+
+// claim a free frame and start the next record in it
+static bool rearm(bool carry)
+{
+    int next = -1;
+    for (int f = 0; f < CAPTURE_NUM_FRAMES; f++) {
+        if (f != acq_frame && cas_owner(f, FRAME_FREE, FRAME_WRITING)) {
+            next = f;
+            break;
+        }
+    }
+    if (next < 0) { return false;}
+
+    if (acq_frame < 0) { acq_buf = NULL;} // nothing to carry over
+    acq_frame = next;
+    lane_len = CAPTURE_FRAME_SAMPLES / num_ch;
+    start_record(&store.samples[next * CAPTURE_FRAME_SAMPLES],
+                 atomic_load_explicit(&req_record_len, memory_order_relaxed),
+                 atomic_load_explicit(&req_pre_len, memory_order_relaxed), carry);
+    return true;
+}
+
+// a gap right before the sample at clock
+static void note_gap(uint64_t clock)
+{
+    uint32_t k = atomic_load_explicit(&gap_count, memory_order_relaxed);
+    gap_clock[k & (GAP_HIST - 1)] = clock;
+    atomic_store_explicit(&gap_count, k + 1, memory_order_relaxed);
+    trigger_reset();
+}
+
+// gaps inside the record that ends right before wr_clock, as offsets from its oldest sample
+static void describe_gaps(capture_frame_t *f)
+{
+    uint64_t first = wr_clock - record_len;
+    uint32_t k = atomic_load_explicit(&gap_count, memory_order_relaxed);
+    uint32_t n = (k < GAP_HIST) ? k : GAP_HIST;
+    f->gaps = 0;
+    // oldest first, so gap_at comes out in order
+    for (uint32_t i = k - n; i != k; i++) {
+        uint64_t g = gap_clock[i & (GAP_HIST - 1)];
+        if (g <= first || g >= wr_clock) { continue;} // a gap right before the oldest sample isn't inside
+        if (f->gaps < CAPTURE_MAX_GAPS) { f->gap_at[f->gaps] = (uint32_t)(g - first);}
+        f->gaps++;
+    }
+}
+
+// fill in the description of the record that just completed
+static void describe(capture_frame_t *f)
+{
+    f->channels = num_ch;
+    for (uint32_t c = 0; c < num_ch; c++) {
+        f->ch[c].base = acq_buf + c * lane_len;
+        f->ch[c].size = record_len;
+        f->ch[c].start = wr; // ring is full, oldest sample sits at the write position
+        f->ch[c].len = record_len;
+        f->skew[c] = atomic_load_explicit(&req_skew[c], memory_order_relaxed);
+    }
+    f->view = f->ch[0];
+    f->trigger = pre_len;
+    f->seq = frame_seq++;
+    f->forced = forced;
+    f->trigger_frac = trig_frac;
+    f->single_gen = single_gen;
+    f->timestamp = trig_time;
+    f->rearm_samples = rearm_lat;
+    f->averaged = 1;
+    f->frac_bits = frac_bits;
+    f->rate_hz = rate_hz;
+    f->range = range;
+    describe_gaps(f);
+}
+
+// record done: describe it and hand it to the display side
+static void publish(void)
+{
+    describe(&frames[acq_frame]);
+
+    // an older record nobody took yet is stale now
+    for (int i = 0; i < CAPTURE_NUM_FRAMES; i++) {
+        if (i != acq_frame) { cas_owner(i, FRAME_READY, FRAME_FREE);}
+    }
+    // release: the samples and the description above are visible before READY is
+    atomic_store_explicit(&owner[acq_frame], FRAME_READY, memory_order_release);
+    state = CAPTURE_READY;
+}
+
+// ---- segmented acquisition ----
+
+// segmented mode lays its segments over the whole store, so it needs every frame.
+// a frame the display still reads is picked up on a later block
+static bool seg_claim_all(void)
+{
+    bool all = true;
+    for (int f = 0; f < CAPTURE_NUM_FRAMES; f++) {
+        if (atomic_load_explicit(&owner[f], memory_order_relaxed) == FRAME_WRITING) { continue;}
+        if (!cas_owner(f, FRAME_FREE, FRAME_WRITING) && !cas_owner(f, FRAME_READY, FRAME_WRITING)) {
+            all = false;
+        }
+    }
+    return all;
+}
+
+// carve the store into segments of the current record shape and arm the first one
+static void seg_restart(void)
+{
+    seg_len = atomic_load_explicit(&req_record_len, memory_order_relaxed);
+    seg_pre = atomic_load_explicit(&req_pre_len, memory_order_relaxed);
+    uint32_t n = atomic_load_explicit(&req_segments, memory_order_relaxed);
+    lane_len = CAPTURE_STORE_SAMPLES / num_ch;
+    if (seg_len > lane_len) { seg_len = lane_len;}
+    if (seg_pre >= seg_len) { seg_pre = seg_len - 1;}
+    if (n > lane_len / seg_len) { n = lane_len / seg_len;}
+    if (n < 1) { n = 1;}
+
+    atomic_store_explicit(&seg_done, 0, memory_order_relaxed);
+    atomic_store_explicit(&seg_total, n, memory_order_relaxed);
+    atomic_store_explicit(&seg_gen, single_gen, memory_order_release);
+    acq_buf = NULL;
+    start_record(store.samples, seg_len, seg_pre, false);
+}
+
+// segment done: publish it and re-arm straight into the next one. the carried
+// history means the trigger is live again on the very next sample
+static void seg_publish(void)
+{
+    uint32_t k = atomic_load_explicit(&seg_done, memory_order_relaxed);
+    describe(&segs[k]);
+    // release: the segment's samples and description are visible before the count is
+    atomic_store_explicit(&seg_done, k + 1, memory_order_release);
+
+    if (k + 1 < atomic_load_explicit(&seg_total, memory_order_relaxed)) {
+        start_record(&store.samples[(k + 1) * seg_len], seg_len, seg_pre, true);
+    } else {
+        state = CAPTURE_STOPPED;
+    }
+}
+
+// ---- averaging ----
+
+// claim a frame that is neither the acquisition frame nor the accumulator:
+// a free one, or a finished record nobody took yet (about to be stale anyway)
+static int claim_other(void)
+{
+    for (int f = 0; f < CAPTURE_NUM_FRAMES; f++) {
+        if (f == acq_frame || f == avg_frame) { continue;}
+        if (cas_owner(f, FRAME_FREE, FRAME_WRITING) || cas_owner(f, FRAME_READY, FRAME_WRITING)) {
+            return f;
+        }
+    }
+    return -1;
+}
+
+// fold n samples of channel c, starting at record index at, into the accumulator. the first
+// record of an average overwrites instead, so a restart never needs a separate clear pass
+static void avg_add(uint32_t c, const uint16_t *s, uint32_t at, uint32_t n)
+{
+    int32_t *acc = &avg_acc[c * record_len + at];
+    if (avg_count == 0) {
+        uint32_t shift = (avg_kind == CAPTURE_AVG_EXPONENTIAL) ? AVG_FRAC_BITS : 0;
+        for (uint32_t i = 0; i < n; i++) { acc[i] = (int32_t)s[i] << shift;}
+    } else if (avg_kind == CAPTURE_AVG_BLOCK) {
+        for (uint32_t i = 0; i < n; i++) { acc[i] += s[i];}
+    } else {
+        // acc += (x - acc) / N, all in Q(AVG_FRAC_BITS)
+        for (uint32_t i = 0; i < n; i++) {
+            acc[i] += (((int32_t)s[i] << AVG_FRAC_BITS) - acc[i]) >> avg_shift;
+        }
+    }
+}
+
+// the pre-trigger history is only known once the trigger fires, fold it in then
+static void avg_add_pre(void)
+{
+    uint32_t from = (wr + record_len - pre_len) % record_len;
+    uint32_t first = record_len - from;
+    if (first > pre_len) { first = pre_len;}
+    for (uint32_t c = 0; c < num_ch; c++) {
+        const uint16_t *lane = acq_buf + c * lane_len;
+        avg_add(c, &lane[from], 0, first);
+        avg_add(c, lane, first, pre_len - first);
+    }
+}
+
+// pick up averaging on / off and setting changes at a record boundary
+static void avg_update(capture_mode_t mode)
+{
+    uint32_t n = atomic_load_explicit(&req_avg_count, memory_order_relaxed);
+    bool want = n > 1 && !seg_active && record_len * num_ch <= CAPTURE_AVG_MAX_SAMPLES &&
+                (mode == CAPTURE_MODE_AUTO || mode == CAPTURE_MODE_NORMAL);
+
+    if (!want) {
+        if (avg_active) {
+            atomic_store_explicit(&owner[avg_frame], FRAME_FREE, memory_order_release);
+            avg_frame = -1;
+            avg_active = false;
+        }
+        return;
+    }
+    if (!avg_active) {
+        avg_frame = claim_other();
+        if (avg_frame < 0) { return;} // try again next record
+        avg_acc = &store.wide[avg_frame * CAPTURE_FRAME_SAMPLES / 2];
+        avg_active = true;
+        avg_count = 0;
+    }
+
+    uint32_t gen = atomic_load_explicit(&req_avg_gen, memory_order_acquire);
+    if (gen != avg_gen || record_len != avg_len) {
+        // new settings or record shape: start the average over
+        avg_gen = gen;
+        avg_len = record_len;
+        avg_kind = atomic_load_explicit(&req_avg_kind, memory_order_relaxed);
+        avg_shift = 0;
+        while ((2u << avg_shift) <= n) { avg_shift++;}
+        avg_n = (avg_kind == CAPTURE_AVG_EXPONENTIAL) ? (1u << avg_shift) : n;
+        avg_count = 0;
+        avg_have_block = false;
+    }
+}
+
+// averaged record done: write the average out to a frame of its own and publish it,
+// then keep acquiring in the same frame. its samples are already in the accumulator
+static void avg_publish(void)
+{
+    // trigger fraction rides along so the averaged trace still lands sub-sample exact
+    if (avg_count == 0) {
+        avg_frac = trig_frac << ((avg_kind == CAPTURE_AVG_EXPONENTIAL) ? AVG_FRAC_BITS : 0);
+    } else if (avg_kind == CAPTURE_AVG_BLOCK) {
+        avg_frac += trig_frac;
+    } else {
+        avg_frac += (int32_t)(((int32_t)trig_frac << AVG_FRAC_BITS) - (int32_t)avg_frac) >> avg_shift;
+    }
+    if (avg_count < avg_n) { avg_count++;}
+
+    // block averaging shows the first block while it builds up, then only whole blocks
+    bool show = avg_kind == CAPTURE_AVG_EXPONENTIAL || avg_count == avg_n || !avg_have_block;
+    int out = show ? claim_other() : -1;
+    if (out >= 0) {
+        capture_frame_t *f = &frames[out];
+        describe(f);
+        // one reciprocal per record instead of a divide per sample
+        uint32_t recip = ((1u << 24) + avg_count / 2) / avg_count;
+        for (uint32_t c = 0; c < num_ch; c++) {
+            uint16_t *dst = &store.samples[out * CAPTURE_FRAME_SAMPLES + c * lane_len];
+            const int32_t *acc = &avg_acc[c * record_len];
+            if (avg_kind == CAPTURE_AVG_EXPONENTIAL) {
+                for (uint32_t i = 0; i < record_len; i++) {
+                    dst[i] = (acc[i] + (1 << (AVG_FRAC_BITS - 1))) >> AVG_FRAC_BITS;
+                }
+            } else {
+                for (uint32_t i = 0; i < record_len; i++) {
+                    dst[i] = ((uint64_t)acc[i] * recip + (1u << 23)) >> 24;
+                }
+            }
+            f->ch[c].base = dst;
+            f->ch[c].start = 0;
+        }
+        f->view = f->ch[0];
+        if (avg_kind == CAPTURE_AVG_EXPONENTIAL) {
+            f->trigger_frac = (avg_frac + (1 << (AVG_FRAC_BITS - 1))) >> AVG_FRAC_BITS;
+        } else {
+            f->trigger_frac = (avg_frac + avg_count / 2) / avg_count;
+        }
+        f->averaged = avg_count;
+        for (int i = 0; i < CAPTURE_NUM_FRAMES; i++) {
+            if (i != out) { cas_owner(i, FRAME_READY, FRAME_FREE);}
+        }
+        atomic_store_explicit(&owner[out], FRAME_READY, memory_order_release);
+    }
+    if (avg_kind == CAPTURE_AVG_BLOCK && avg_count == avg_n) {
+        avg_count = 0;
+        avg_have_block = true;
+    }
+
+    // re-arm in place: the ring already holds the newest samples as pre-trigger history
+    uint32_t new_len = atomic_load_explicit(&req_record_len, memory_order_relaxed);
+    uint32_t new_pre = atomic_load_explicit(&req_pre_len, memory_order_relaxed);
+    if (new_len != record_len || new_pre != pre_len) {
+        start_record(acq_buf, new_len, new_pre, false);
+        return;
+    }
+    uint32_t keep_wr = wr, keep_filled = filled;
+    restart_record();
+    wr = keep_wr;
+    filled = keep_filled;
+}
+
+// back to frames: hand the store back and start over in a fresh frame
+static void seg_leave(void)
+{
+    seg_active = false;
+    atomic_store_explicit(&seg_done, 0, memory_order_relaxed);
+    for (int f = 0; f < CAPTURE_NUM_FRAMES; f++) {
+        atomic_store_explicit(&owner[f], FRAME_FREE, memory_order_release);
+    }
+    acq_frame = -1;
+    rearm(false);
+}
+
+void capture_init(void)
+{
+    memset(&store, 0, sizeof(store));
+    for (int f = 0; f < CAPTURE_NUM_FRAMES; f++) {
+        atomic_store_explicit(&owner[f], FRAME_FREE, memory_order_relaxed);
+    }
+    held_frame = -1;
+    acq_frame = -1;
+    if (atomic_load_explicit(&req_record_len, memory_order_relaxed) == 0) {
+        capture_set_record(HW_LCD_W, HW_LCD_W / 2);
+    }
+    rearm(false);
+}
+
+void capture_set_record(uint32_t len, uint32_t pre)
+{
+    if (len < 1) { len = 1;}
+    if (len > CAPTURE_FRAME_SAMPLES) { len = CAPTURE_FRAME_SAMPLES;}
+    if (pre >= len) { pre = len - 1;} // trigger sample has to be inside the record
+    atomic_store_explicit(&req_record_len, len, memory_order_relaxed);
+    atomic_store_explicit(&req_pre_len, pre, memory_order_relaxed);
+}
+
+void capture_set_mode(capture_mode_t mode)
+{
+    // segmented mode needs the frame the display holds too
+    if (mode == CAPTURE_MODE_SEGMENTED && held_frame >= 0) {
+        atomic_store_explicit(&owner[held_frame], FRAME_FREE, memory_order_release);
+        held_frame = -1;
+    }
+    atomic_store_explicit(&req_mode, mode, memory_order_relaxed);
+}
+
+capture_mode_t capture_get_mode(void)
+{
+    return atomic_load_explicit(&req_mode, memory_order_relaxed);
+}
+
+void capture_set_holdoff(uint32_t samples)
+{
+    atomic_store_explicit(&req_holdoff, samples, memory_order_relaxed);
+}
+
+void capture_arm_single(void)
+{
+    atomic_fetch_add_explicit(&req_single_gen, 1, memory_order_release);
+}
+
+void capture_set_average(uint32_t n, capture_avg_t kind)
+{
+    if (n < 1) { n = 1;}
+    if (n > CAPTURE_AVG_MAX_COUNT) { n = CAPTURE_AVG_MAX_COUNT;}
+    atomic_store_explicit(&req_avg_count, n, memory_order_relaxed);
+    atomic_store_explicit(&req_avg_kind, kind, memory_order_relaxed);
+    atomic_fetch_add_explicit(&req_avg_gen, 1, memory_order_release);
+}
+
+void capture_set_sample_bits(uint32_t bits)
+{
+    atomic_store_explicit(&req_frac_bits, bits, memory_order_relaxed);
+}
+
+void capture_set_segments(uint32_t n)
+{
+    if (n < 1) { n = 1;}
+    if (n > CAPTURE_MAX_SEGMENTS) { n = CAPTURE_MAX_SEGMENTS;}
+    atomic_store_explicit(&req_segments, n, memory_order_relaxed);
+}
+
+void capture_set_sample_rate(uint32_t rate_hz)
+{
+    atomic_store_explicit(&req_rate_hz, rate_hz ? rate_hz : 1, memory_order_relaxed);
+}
+
+void capture_set_range(uint32_t r, uint32_t code_scale)
+{
+    atomic_store_explicit(&req_code_scale, code_scale, memory_order_relaxed);
+    atomic_store_explicit(&req_range, r, memory_order_relaxed);
+}
+
+void capture_set_channels(uint32_t n)
+{
+    if (n < 1) { n = 1;}
+    if (n > CAPTURE_MAX_CHANNELS) { n = CAPTURE_MAX_CHANNELS;}
+    num_ch = n;
+}
+
+void capture_set_channel_skew(uint32_t ch, uint32_t skew)
+{
+    if (ch < CAPTURE_MAX_CHANNELS) { atomic_store_explicit(&req_skew[ch], skew, memory_order_relaxed);}
+}
+
+void capture_write_block(const uint16_t *samples, size_t n, uint64_t timestamp)
+{
+    capture_write_channels(&samples, n, timestamp);
+}
+
+void capture_write_channels(const uint16_t *const *chans, size_t n, uint64_t timestamp)
+{
+    const uint16_t *samples = chans[0];
+    for (uint32_t c = 0; c < num_ch; c++) { blk_chan[c] = chans[c];}
+    blk_ptr = samples;
+    blk_clock = fed;
+    blk_time = timestamp;
+    fed += n;
+
+    capture_mode_t mode = atomic_load_explicit(&req_mode, memory_order_relaxed);
+    uint32_t gen = atomic_load_explicit(&req_single_gen, memory_order_acquire);
+    uint32_t bits = atomic_load_explicit(&req_frac_bits, memory_order_relaxed);
+    uint32_t rate = atomic_load_explicit(&req_rate_hz, memory_order_relaxed);
+    uint32_t rng = atomic_load_explicit(&req_range, memory_order_relaxed);
+    if (bits != frac_bits || rate != rate_hz || rng != range) {
+        // sample format, rate or input range changed: the record so far (and any average)
+        // doesn't line up with the new samples
+        if (bits != frac_bits) { trigger_set_frac_bits(bits);}
+        if (rng != range) { trigger_set_code_scale(atomic_load_explicit(&req_code_scale, memory_order_relaxed));}
+        frac_bits = bits;
+        rate_hz = rate;
+        range = rng;
+        avg_count = 0;
+        if (seg_active) {
+            seg_restart();
+        } else if (state == CAPTURE_READY) {
+            acq_buf = NULL; // the finished record's tail can't seed the next one
+        } else if (state != CAPTURE_STOPPED) {
+            restart_record();
+        }
+        record_end = clock_at(samples);
+    }
+    if ((mode == CAPTURE_MODE_SEGMENTED) != seg_active) {
+        if (seg_active) {
+            seg_leave();
+        } else {
+            if (!seg_claim_all()) { return;} // display still has its frame, try again next block
+            seg_active = true;
+            avg_active = false; // the accumulator frame went to the segments too
+            avg_frame = -1;
+            single_gen = gen;
+            seg_restart();
+        }
+        record_end = clock_at(samples);
+    }
+    if (gen != single_gen) {
+        // new single shot: whatever was in flight started before the arm, so start over
+        single_gen = gen;
+        if (seg_active) {
+            seg_restart();
+        } else if (state == CAPTURE_STOPPED || state == CAPTURE_READY) {
+            rearm(false);
+        } else {
+            restart_record();
+        }
+        record_end = clock_at(samples);
+    }
+
+    while (n > 0 || state == CAPTURE_POST_TRIGGER) {
+        switch (state) {
+        case CAPTURE_STOPPED:
+            if (mode == CAPTURE_MODE_SINGLE || seg_active) { return;}
+            // left single mode, back to running
+            if (!rearm(false)) { return;}
+            record_end = clock_at(samples);
+            break;
+
+        case CAPTURE_READY:
+            if (mode == CAPTURE_MODE_SINGLE) {
+                state = CAPTURE_STOPPED;
+                return;
+            }
+            if (!rearm(true)) {
+                // every other frame is busy, these samples are lost
+                atomic_fetch_add_explicit(&lost_samples, n, memory_order_relaxed);
+                losing = true;
+                return;
+            }
+            if (losing) {
+                // the carried history ends before the lost stretch, the new samples start after it
+                losing = false;
+                note_gap(clock_at(samples));
+            }
+            break;
+
+        case CAPTURE_ARMED:
+            avg_update(mode);
+            state = CAPTURE_PRE_TRIGGER;
+            break;
+
+        case CAPTURE_PRE_TRIGGER: {
+            // history first, the trigger may only fire once there is pre_len of it
+            if (filled < pre_len) {
+                size_t run = pre_len - filled;
+                if (run > n) { run = n;}
+                ring_write(samples, run);
+                samples += run;
+                n -= run;
+                if (holdoff_left > 0) { holdoff_left -= (run < holdoff_left) ? run : holdoff_left;}
+                if (filled < pre_len) { return;}
+            }
+            if (n == 0) { return;}
+
+            // still inside the holdoff: these samples only roll the history
+            if (holdoff_left > 0) {
+                size_t run = (holdoff_left < n) ? holdoff_left : n;
+                ring_write(samples, run);
+                samples += run;
+                n -= run;
+                holdoff_left -= run;
+                break;
+            }
+
+            // first sample the trigger can fire on: the blind time since the last record ends here
+            if (!live) {
+                live = true;
+                rearm_lat = (uint32_t)(clock_at(samples) - record_end);
+            }
+
+            // keep rolling history until the trigger engine finds an event in this block
+            int32_t hit = trigger_scan(samples, n);
+            if (mode == CAPTURE_MODE_AUTO && auto_left < n && (hit < 0 || (uint32_t)hit > auto_left)) {
+                hit = auto_left; // nothing triggered within a record length, free run this one
+                forced = true;
+            }
+            if (hit < 0) {
+                ring_write(samples, n);
+                auto_left -= n;
+                return;
+            }
+            ring_write(samples, hit);
+            samples += hit;
+            n -= hit;
+            // interpolate the real crossing against the sample just before the trigger sample
+            if (!forced && filled > 0) {
+                trig_frac = trigger_crossing_frac(acq_buf[(wr + record_len - 1) % record_len], samples[0]);
+            }
+            trig_time = blk_time + (uint64_t)(samples - blk_ptr) * TIMER_RESOLUTION_HZ / rate_hz;
+            // the trigger sample itself is the first post-trigger sample
+            post_left = record_len - pre_len;
+            holdoff_left = atomic_load_explicit(&req_holdoff, memory_order_relaxed);
+            if (avg_active) {
+                if (forced) { avg_count = 0;} // free run record, nothing to line up with: restart the average
+                avg_add_pre();
+            }
+            state = CAPTURE_POST_TRIGGER;
+            break;
+        }
+
+        case CAPTURE_POST_TRIGGER: {
+            size_t run = post_left;
+            if (run > n) { run = n;}
+            ring_write(samples, run);
+            if (avg_active) {
+                // keeps pace per block
+                for (uint32_t c = 0; c < num_ch; c++) {
+                    avg_add(c, blk_chan[c] + (samples - blk_ptr), record_len - post_left, run);
+                }
+            }
+            samples += run;
+            n -= run;
+            post_left -= run;
+            holdoff_left -= (run < holdoff_left) ? run : holdoff_left;
+            if (post_left > 0) { return;}
+            if (seg_active) {
+                seg_publish();
+            } else if (avg_active) {
+                avg_publish();
+            } else {
+                publish();
+            }
+            record_end = clock_at(samples);
+            break;
+        }
+        }
+    }
+}
+
+void capture_mark_gap(void)
+{
+    note_gap(fed);
+}
+
+uint32_t capture_gaps_marked(void)
+{
+    return atomic_load_explicit(&gap_count, memory_order_relaxed);
+}
+
+uint32_t capture_lost_samples(void)
+{
+    return atomic_load_explicit(&lost_samples, memory_order_relaxed);
+}
+
+capture_state_t capture_get_state(void)
+{
+    return state;
+}
+
+const capture_frame_t *capture_take_frame(void)
+{
+    return capture_take_frame_matching(0, 0);
+}
+
+const capture_frame_t *capture_take_frame_matching(uint32_t rate_hz, uint32_t min_len)
+{
+    if (capture_get_mode() == CAPTURE_MODE_SEGMENTED) { return NULL;} // frames are not in use
+    for (int f = 0; f < CAPTURE_NUM_FRAMES; f++) {
+        int expect = FRAME_READY;
+        if (atomic_compare_exchange_strong_explicit(&owner[f], &expect, FRAME_READING,
+                                                    memory_order_acquire, memory_order_relaxed)) {
+            // single shot: records from before the latest arm are not the one asked for.
+            // nor are records from before a rate or length change
+            if ((capture_get_mode() == CAPTURE_MODE_SINGLE &&
+                 frames[f].single_gen != atomic_load_explicit(&req_single_gen, memory_order_acquire)) ||
+                (rate_hz != 0 && frames[f].rate_hz != rate_hz) || frames[f].view.len < min_len) {
+                atomic_store_explicit(&owner[f], FRAME_FREE, memory_order_release);
+                return NULL;
+            }
+            if (held_frame >= 0) {
+                atomic_store_explicit(&owner[held_frame], FRAME_FREE, memory_order_release);
+            }
+            held_frame = f;
+            return &frames[f];
+        }
+    }
+    return NULL;
+}
+
+const capture_frame_t *capture_held_frame(void)
+{
+    return (held_frame >= 0) ? &frames[held_frame] : NULL;
+}
+
+uint32_t capture_segments_done(void)
+{
+    // until the writer has acted on the latest arm, the old segments don't count
+    if (capture_get_mode() != CAPTURE_MODE_SEGMENTED ||
+        atomic_load_explicit(&seg_gen, memory_order_acquire) !=
+        atomic_load_explicit(&req_single_gen, memory_order_relaxed)) {
+        return 0;
+    }
+    return atomic_load_explicit(&seg_done, memory_order_acquire);
+}
+
+uint32_t capture_segments_total(void)
+{
+    return atomic_load_explicit(&seg_total, memory_order_relaxed);
+}
+
+const capture_frame_t *capture_segment(uint32_t i)
+{
+    if (i >= capture_segments_done()) { return NULL;}
+    return &segs[i];
+}
+
+capture_view_t capture_view_slice(const capture_view_t *view, uint32_t offset, uint32_t len)
+{
+    if (offset > view->len) { offset = view->len;}
+    if (len > view->len - offset) { len = view->len - offset;}
+
+    capture_view_t slice = *view;
+    slice.start = (view->start + offset) % view->size;
+    slice.len = len;
+    return slice;
+}
+
+// min / max over one contiguous run. two independent compare chains per iteration keep
+// the loop free of branches (minu / maxu on xtensa, vectorized on the host)
+static void minmax_run(const uint16_t *s, uint32_t n, uint16_t *min, uint16_t *max)
+{
+    uint16_t lo0 = *min, hi0 = *max, lo1 = *min, hi1 = *max;
+    uint32_t i = 0;
+    for (; i + 1 < n; i += 2) {
+        uint16_t a = s[i], b = s[i + 1];
+        lo0 = (a < lo0) ? a : lo0;
+        hi0 = (a > hi0) ? a : hi0;
+        lo1 = (b < lo1) ? b : lo1;
+        hi1 = (b > hi1) ? b : hi1;
+    }
+    if (i < n) {
+        lo0 = (s[i] < lo0) ? s[i] : lo0;
+        hi0 = (s[i] > hi0) ? s[i] : hi0;
+    }
+    *min = (lo0 < lo1) ? lo0 : lo1;
+    *max = (hi0 > hi1) ? hi0 : hi1;
+}
+
+void capture_view_minmax(const capture_view_t *view, uint32_t offset, uint32_t len,
+                         uint16_t *min, uint16_t *max)
+{
+    if (view->len == 0) {
+        *min = UINT16_MAX;
+        *max = 0;
+        return;
+    }
+    if (offset >= view->len) { offset = view->len - 1;}
+    if (len == 0) { len = 1;}
+    *min = *max = capture_view_at(view, offset);
+
+    capture_view_t slice = capture_view_slice(view, offset, len);
+    const uint16_t *run0, *run1;
+    uint32_t len0, len1;
+    int runs = capture_view_runs(&slice, &run0, &len0, &run1, &len1);
+    if (runs > 0) { minmax_run(run0, len0, min, max);}
+    if (runs > 1) { minmax_run(run1, len1, min, max);}
+}
+
+int capture_view_runs(const capture_view_t *view, const uint16_t **run0, uint32_t *len0,
+                      const uint16_t **run1, uint32_t *len1)
+{
+    uint32_t first = view->size - view->start;
+    *run0 = &view->base[view->start];
+    *run1 = view->base;
+    if (view->len <= first) {
+        *len0 = view->len;
+        *len1 = 0;
+        return view->len ? 1 : 0;
+    }
+    *len0 = first;
+    *len1 = view->len - first;
+    return 2;
+}
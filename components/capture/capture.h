@@ -0,0 +1,200 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "config.h"
+
+// The capture store: the one place acquired samples live.
+// consumers (renderer, cursor, logger, analysis) never copy out of it, they get a
+// read only view that describes a window of the ring, including wrap around.
+//
+// The store is split into frames. adc_sample_task fills one frame through the
+// acquisition state machine while the display owns another. a finished frame
+// changes hands by an atomic ownership swap, so the renderer never sees samples
+// that are still being written and the hot path takes no locks. the third frame
+// means the writer always has somewhere to re-arm into, even while the display
+// holds one record and a newer one waits to be taken.
+//
+// Segmented mode instead lays N back to back segments over the whole store. each
+// segment re-arms straight into the next with the pre-trigger history carried over,
+// so bursts of events are caught without a redraw in between; the display steps
+// through them once the last one is in.
+//
+// Averaging folds every triggered record into a wide integer accumulator that lives
+// in a frame of its own (no second float record anywhere), block by block as the
+// samples arrive, and publishes the averaged record instead of the raw one.
+//
+// With more than one channel every frame (or the whole store, when segmented) is split
+// into one lane per channel. channel 0 drives the trigger, the others are written
+// alongside it at the same ring position, so one record holds all channels at the same
+// instants give or take the scan skew recorded with it.
+
+#define CAPTURE_NUM_FRAMES      4
+#define CAPTURE_FRAME_SAMPLES   (CAPTURE_STORE_SAMPLES / CAPTURE_NUM_FRAMES)
+#define CAPTURE_MAX_SEGMENTS    64
+#define CAPTURE_AVG_MAX_COUNT   256
+#define CAPTURE_AVG_MAX_SAMPLES (CAPTURE_FRAME_SAMPLES / 2) // int32 accumulator fits one frame (all channels)
+#define CAPTURE_MAX_CHANNELS    4
+#define CAPTURE_MAX_GAPS        4   // gap positions kept per record
+
+typedef struct {
+    const uint16_t *base;   // start of the backing ring
+    uint32_t size;          // ring length, indices wrap at this
+    uint32_t start;         // ring index of the first sample in the window
+    uint32_t len;           // samples in the window
+} capture_view_t;
+
+// acquisition state machine, advanced by capture_write_block
+typedef enum {
+    CAPTURE_ARMED,          // frame claimed, nothing written yet
+    CAPTURE_PRE_TRIGGER,    // filling pre-trigger history, waiting for the trigger
+    CAPTURE_POST_TRIGGER,   // trigger seen, filling the rest of the record
+    CAPTURE_READY,          // record complete, waiting for a free frame to re-arm into
+    CAPTURE_STOPPED,        // single shot / all segments taken, waiting for capture_arm_single
+} capture_state_t;
+
+// trigger modes
+typedef enum {
+    CAPTURE_MODE_AUTO,      // free runs a record if no trigger shows up within a record length
+    CAPTURE_MODE_NORMAL,    // only triggered records
+    CAPTURE_MODE_SINGLE,    // one triggered record, then stop
+    CAPTURE_MODE_SEGMENTED, // N triggered records back to back into the whole store, then stop
+} capture_mode_t;
+
+// how records are averaged
+typedef enum {
+    CAPTURE_AVG_EXPONENTIAL,    // running average, each record weighs 1/N (N rounded down to a power of two)
+    CAPTURE_AVG_BLOCK,          // plain mean of N records, shown once per N
+} capture_avg_t;
+
+// one completed record
+typedef struct {
+    capture_view_t view;    // the whole record, oldest sample first
+    uint32_t trigger;       // offset of the trigger sample inside view (== pre-trigger length)
+    uint16_t trigger_frac;  // the real crossing lies this far before it, 1/TRIGGER_FRAC_ONE samples
+    uint32_t seq;           // increments per completed record
+    bool forced;            // auto mode timed out, trigger point is arbitrary
+    uint32_t single_gen;    // single shot arm this record belongs to
+    uint64_t timestamp;     // timer count (TIMER_RESOLUTION_HZ) of the trigger sample
+    uint32_t rearm_samples; // blind time before the trigger went live: samples since the previous record ended
+    uint32_t averaged;      // records that went into this one (1 = raw)
+    uint32_t frac_bits;     // samples are 12 bit codes << frac_bits (hi-res), 0 = plain codes
+    uint32_t rate_hz;       // sample rate the record was taken at
+    uint32_t range;         // input range (ADC attenuation) the record was taken at, see ADC_RANGES
+    uint32_t channels;      // channels in the record, ch[0] is the same as view
+    capture_view_t ch[CAPTURE_MAX_CHANNELS];
+    uint16_t skew[CAPTURE_MAX_CHANNELS];    // channel c was sampled this much after channel 0, 1/TRIGGER_FRAC_ONE samples
+    uint32_t gaps;          // discontinuities inside the record (samples lost upstream)
+    uint32_t gap_at[CAPTURE_MAX_GAPS];  // offsets into view of the first sample after each, the first CAPTURE_MAX_GAPS
+} capture_frame_t;
+
+// clears the store and arms the first frame
+void capture_init(void);
+
+// channels per record (1..CAPTURE_MAX_CHANNELS). the record length is capped to what a
+// lane holds. set up once, before the first block
+void capture_set_channels(uint32_t n);
+
+// record length and how much of it comes before the trigger. applied on the next re-arm
+void capture_set_record(uint32_t record_len, uint32_t pretrigger_len);
+
+// trigger mode. leaving single mode resumes acquisition. switching to segmented mode
+// hands the held frame back, the segments need the whole store
+void capture_set_mode(capture_mode_t mode);
+capture_mode_t capture_get_mode(void);
+
+// samples after a trigger during which no new trigger is accepted
+void capture_set_holdoff(uint32_t samples);
+
+// single mode: arm for one more record, segmented mode: start a new set of segments.
+// anything in flight or finished before the call is dropped
+void capture_arm_single(void);
+
+// average n (2..CAPTURE_AVG_MAX_COUNT) triggered records, 1 turns averaging off.
+// only in auto / normal mode and for records up to CAPTURE_AVG_MAX_SAMPLES (all channels together), otherwise
+// records come through raw. restarts the average
+void capture_set_average(uint32_t n, capture_avg_t kind);
+
+// segments per segmented acquisition (clamped to CAPTURE_MAX_SEGMENTS and to what fits the store)
+void capture_set_segments(uint32_t n);
+
+// signal sample rate, turns sample offsets into timestamps. a change drops the record in
+// progress, so set it from the writer right before the first block at the new rate
+void capture_set_sample_rate(uint32_t rate_hz);
+
+// channel ch is sampled skew (1/TRIGGER_FRAC_ONE samples) after channel 0. set from the
+// writer like the sample rate, it follows the decimation
+void capture_set_channel_skew(uint32_t ch, uint32_t skew);
+
+// input range of the incoming samples and the Q16 scale from its codes to the codes the
+// trigger levels are given in. set from the writer like the sample rate: a change drops
+// the record in progress, so no record mixes two ranges
+void capture_set_range(uint32_t range, uint32_t code_scale);
+
+// incoming samples carry bits extra bits below the 12 bit code (hi-res). the record in
+// progress is dropped and the trigger levels are rescaled
+void capture_set_sample_bits(uint32_t bits);
+
+// feeds n samples through the state machine (single writer: adc_sample_task).
+// timestamp is the timer count of samples[0]. single channel records only
+void capture_write_block(const uint16_t *samples, size_t n, uint64_t timestamp);
+
+// same for a multi-channel record: samples[c] holds n samples of channel c, taken at
+// the same instants (give or take the skew)
+void capture_write_channels(const uint16_t *const *samples, size_t n, uint64_t timestamp);
+
+// samples were lost between the last block written and the next one (writer only).
+// records spanning the spot list it in gaps / gap_at, and the trigger starts over
+// since an edge across it can't be trusted
+void capture_mark_gap(void);
+
+// gaps marked so far, by the writer or because every frame was busy
+uint32_t capture_gaps_marked(void);
+
+// samples dropped because no frame was free to record into
+uint32_t capture_lost_samples(void);
+
+// current state of the writer side
+capture_state_t capture_get_state(void);
+
+// takes ownership of the newest completed frame and hands the previously taken
+// one back to acquisition. NULL (and nothing released) if no new frame is ready
+const capture_frame_t *capture_take_frame(void);
+
+// capture_take_frame for a newest frame recorded at rate_hz (0 = any) holding at least
+// min_len samples. one that isn't is stale: it goes back to acquisition and the
+// previously taken frame stays held
+const capture_frame_t *capture_take_frame_matching(uint32_t rate_hz, uint32_t min_len);
+
+// frame currently owned by the display, NULL before the first take
+const capture_frame_t *capture_held_frame(void);
+
+// segmented mode: segments completed so far, and how many the acquisition is after
+uint32_t capture_segments_done(void);
+uint32_t capture_segments_total(void);
+
+// i-th completed segment, NULL if it is not in yet. valid until the next
+// capture_arm_single / capture_set_mode
+const capture_frame_t *capture_segment(uint32_t i);
+
+// sub window of a view, offset/len relative to the view (clamped to it)
+capture_view_t capture_view_slice(const capture_view_t *view, uint32_t offset, uint32_t len);
+
+// splits a view into at most two contiguous runs for bulk consumers. returns the number of runs
+int capture_view_runs(const capture_view_t *view, const uint16_t **run0, uint32_t *len0,
+                      const uint16_t **run1, uint32_t *len1);
+
+// smallest and largest sample in [offset, offset + len) of a view (peak detect buckets).
+// len 0 gives the single sample at offset. an empty view has no samples: min comes
+// back UINT16_MAX and max 0
+void capture_view_minmax(const capture_view_t *view, uint32_t offset, uint32_t len,
+                         uint16_t *min, uint16_t *max);
+
+// i-th sample of a view
+static inline uint16_t capture_view_at(const capture_view_t *view, uint32_t i)
+{
+    uint32_t idx = view->start + i;
+    if (idx >= view->size) { idx -= view->size;}
+    return view->base[idx];
+}
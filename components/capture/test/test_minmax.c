@@ -0,0 +1,131 @@
+#include "capture.h"
+#include "trigger.h"
+#include "host_test.h"
+
+// peak detect: capture_view_minmax matches a plain scan on wrapped and unwrapped views,
+// and bucketing a record into screen columns the way the renderer does (each column runs
+// up to the next column's first sample) leaves no sample out, so a one sample glitch
+// anywhere in the record shows in the span of the column over it. also times the kernel
+// against the plain scan
+
+#define RING    8192
+#define COLS    HW_LCD_W
+#define BENCH_REP   2000
+
+static uint16_t ring[RING];
+
+static void naive(const capture_view_t *v, uint32_t off, uint32_t len, uint16_t *lo, uint16_t *hi)
+{
+    *lo = 0xffff;
+    *hi = 0;
+    for (uint32_t i = off; i < off + len && i < v->len; i++) {
+        uint16_t s = capture_view_at(v, i);
+        if (s < *lo) { *lo = s;}
+        if (s > *hi) { *hi = s;}
+    }
+}
+
+static void against_naive(void)
+{
+    for (int i = 0; i < RING; i++) { ring[i] = (i * 2654435761u) >> 20;}
+    // unwrapped, wrapping in the middle, wrapping on the last sample
+    uint32_t starts[] = { 0, RING - 100, RING - 1 };
+    int bad = 0;
+    for (int s = 0; s < 3; s++) {
+        capture_view_t v = { ring, RING, starts[s], 400 };
+        for (uint32_t len = 1; len <= 41; len++) {
+            for (uint32_t off = 0; off + len <= v.len; off++) {
+                uint16_t lo, hi, nlo, nhi;
+                capture_view_minmax(&v, off, len, &lo, &hi);
+                naive(&v, off, len, &nlo, &nhi);
+                if (lo != nlo || hi != nhi) { bad++;}
+            }
+        }
+        // len 0 is the one sample at offset, offsets past the end clamp to the last one
+        uint16_t lo, hi;
+        capture_view_minmax(&v, 7, 0, &lo, &hi);
+        CHECK(lo == capture_view_at(&v, 7) && hi == lo);
+        capture_view_minmax(&v, 1000, 4, &lo, &hi);
+        CHECK(lo == capture_view_at(&v, v.len - 1) && hi == lo);
+    }
+    CHECK(bad == 0);
+
+    // nothing to read in an empty view
+    capture_view_t empty = { ring, RING, 5, 0 };
+    uint16_t lo, hi;
+    capture_view_minmax(&empty, 0, 4, &lo, &hi);
+    CHECK(lo == UINT16_MAX && hi == 0);
+}
+
+// the renderer's columns over a record of len samples: Q8 step so COLS columns cover it
+static void columns(uint32_t len, uint32_t start)
+{
+    capture_view_t v = { ring, RING, start, len };
+    int32_t step = (int32_t)(((len - 1) << TRIGGER_FRAC_BITS) / (COLS - 1));
+    int missed = 0, spans_apart = 0;
+    for (uint32_t glitch = 0; glitch < len; glitch++) {
+        for (int i = 0; i < RING; i++) { ring[i] = 2048;}
+        ring[(start + glitch) % RING] = 4000;
+        ring[(start + (glitch + len / 2) % len) % RING] = 100;
+        bool seen_hi = false, seen_lo = false;
+        uint16_t prev_lo = 0, prev_hi = 0;
+        for (int x = 0; x < COLS; x++) {
+            int32_t pos = x * step;
+            uint32_t idx = pos >> TRIGGER_FRAC_BITS;
+            uint32_t next = (pos + step) >> TRIGGER_FRAC_BITS;
+            uint16_t lo, hi;
+            capture_view_minmax(&v, idx, next - idx + 1, &lo, &hi);
+            seen_hi |= hi == 4000;
+            seen_lo |= lo == 100;
+            // neighbouring spans share a sample, so the trace has no vertical breaks
+            if (x > 0 && (lo > prev_hi || hi < prev_lo)) { spans_apart++;}
+            prev_lo = lo;
+            prev_hi = hi;
+        }
+        if (!seen_hi || !seen_lo) { missed++;}
+    }
+    printf("record %5u: %.2f samples per column, %d glitches missed\n", len, step / (double)(1 << TRIGGER_FRAC_BITS), missed);
+    CHECK(missed == 0);
+    CHECK(spans_apart == 0);
+}
+
+// a full wrapped record reduced in buckets of width samples, kernel and plain scan
+static void speed(uint32_t width)
+{
+    for (int i = 0; i < RING; i++) { ring[i] = (i * 2654435761u) >> 20;}
+    capture_view_t v = { ring, RING, RING / 2, RING };
+    volatile uint16_t sink;
+    uint16_t lo, hi;
+    double t = host_test_now();
+    for (int r = 0; r < BENCH_REP; r++) {
+        for (uint32_t off = 0; off < RING; off += width) {
+            capture_view_minmax(&v, off, width, &lo, &hi);
+            sink = lo ^ hi;
+        }
+    }
+    double tk = host_test_now() - t;
+    t = host_test_now();
+    for (int r = 0; r < BENCH_REP; r++) {
+        for (uint32_t off = 0; off < RING; off += width) {
+            naive(&v, off, width, &lo, &hi);
+            sink = lo ^ hi;
+        }
+    }
+    double tn = host_test_now() - t;
+    (void)sink;
+    printf("buckets of %4u: capture_view_minmax %.3f ns/sample, plain scan %.3f ns/sample\n", width,
+           tk * 1e9 / RING / BENCH_REP, tn * 1e9 / RING / BENCH_REP);
+}
+
+int main(void)
+{
+    against_naive();
+    columns(COLS, 0);
+    columns(COLS * 2 + 37, RING - 300);
+    columns(COLS * 20, 5000);
+    columns(6400, RING - 1);
+    speed(2);
+    speed(16);
+    speed(256);
+    return HOST_TEST_RESULT();
+}
@@ -41,9 +41,12 @@
 //---------- Joystick ----------//
 #define HW_JOY_X            34
 #define HW_JOY_Y            35
+#define ADC_JOY_X_CHANNEL   ADC_CHANNEL_6 // GPIO34, sampled by the adc_stream scan pattern
+#define ADC_JOY_Y_CHANNEL   ADC_CHANNEL_7 // GPIO35
 #define AVG_ALPHA           0.15f
 #define DEADZONE            60
 #define JOY_SENSITIVITY     25.0f  // adjust joystick sensitivity for cursor movement
+#define JOY_STEP_THRESHOLD  50     // % deflection on X that steps to the next / previous segment
 
 //---------- SD card ----------//
 #define HW_SD_MISO 19
@@ -59,12 +62,16 @@
 
 // --------- COLORS ----------//
 #define WAVEFORM_COLOR              BLUE
+#define SCOPE_CH_COLORS             { WAVEFORM_COLOR, GREEN, MAGENTA, CYAN } // trace color per channel
 #define FROZEN_TXT_COLOR            BLACK
+#define MODE_TXT_COLOR              BLACK
 #define TIMEBASE_TXT_COLOR         BLACK
 #define CURSOR_COLOR                RED
 #define BACKGROUND_COLOR            WHITE
 #define GRID_COLOR                  BLACK
 #define VOLTAGE_TXT_COLOR           BLACK
+#define TRIGGER_COLOR               RED
+#define GAP_COLOR                   GRAY  // marks where samples were lost inside a record
 
 #define NUM_GRID_LINES              5
 // grid line macro for drawing grid_line(n)
@@ -72,16 +79,53 @@
 #define GRID_LINE_HORIZONTAL(n) ((n) * LCD_H / (NUM_GRID_LINES+1))
 
 // ---------- ADC ----------//
-#define SAMPLE_RATE_HZ          10000 // 10kHz sample rate
-#define ADC_QUEUE_LENGTH        1024
+#define SAMPLES_PER_COLUMN      2     // the timebase picks the sample rate for about this many samples per screen column
+#define DISPLAY_INTERP          INTERP_SINC // upsampling when a screen has fewer samples than columns (INTERP_LINEAR / INTERP_SINC)
 #define ADC_MIDPOINT            (4096 / 2)
 #define LCD_MID_HORIZONTAL      (HW_LCD_H / 2)
-#define ADC_CHANNEL             ADC_CHANNEL_2 // GPIO2 (on 330 board schematic its IO2) ONLY WORKS AS ADC if wifi is off
-#define ADC_BUFFER_SIZE         8192 // was 4096 but testing a change...
-#define SAMPLE_BUFFER_SIZE      ADC_BUFFER_SIZE 
+#define ADC_CHANNEL             ADC_CHANNEL_0 // GPIO36 (VP). DMA mode on the ESP32 is ADC1 only, so the probe left IO2
+#define SCOPE_CHANNELS          1             // analog inputs scanned together (1..4), channel 0 is the trigger source
+#define SCOPE_INTERLEAVE        0             // 1 = GPIO36 and 37 both wired to the probe, merged into one channel at twice the rate
+#define SCOPE_ADC_CHANNELS      { ADC_CHANNEL, ADC_CHANNEL_1, ADC_CHANNEL_2, ADC_CHANNEL_3 } // GPIO36, 37, 38 (where the module breaks them out), then 39, which is BTN_START: a 4th channel takes the button
+#define SCOPE_CH_OFFSETS        { 0, 60, -60, 30 } // vertical position of each trace, pixels down from mid screen
+#define ADC_JITTER_HIST         0     // 1 = histogram the DMA frame interrupt intervals, p50 / p99 / max logged with the core load
+#define ADC_AUTORANGE           0     // 1 = pick the attenuation from the recent signal peak. 0 = always 12 dB, the only calibrated range (0 / 2.5 / 6 dB borrow its table through nominal ratios)
+#define ADC_RANGE_UP_PCT        95    // step to a wider range once a record reaches this much of the current one
+#define ADC_RANGE_DOWN_PCT      80    // narrower range only when the peak fits in this much of it
+#define ADC_RANGE_DOWN_RECORDS  8     // for this many records in a row
+#define CAPTURE_STORE_SAMPLES   32768 // one shared store (64 KB), carved into 4 x 8192 sample frames
+
+// ---------- Trigger ----------//
+#define TRIGGER_LEVEL           ADC_MIDPOINT // raw code
+#define TRIGGER_HYSTERESIS      40           // raw codes (~100 mV) of noise rejection
+#define TRIGGER_PRETRIGGER_PCT  50           // trigger point position on screen, % from the left
+#define TRIGGER_HOLDOFF_SAMPLES 0            // samples after a record before the trigger may fire again
+#define FROZEN_TXT              "STOPPED"    // shown while a single shot record is held
+#define ARMED_TXT               "ARMED"      // shown while waiting for the single shot trigger
+#define CAPTURE_SEGMENTS        16           // segments per segmented acquisition (max CAPTURE_MAX_SEGMENTS)
+#define AVERAGE_COUNT           16           // records per average in AVG mode (2..256)
+#define AVERAGE_EXPONENTIAL     1            // 1 = running (exponential) average, 0 = block average of AVERAGE_COUNT
+#define HIRES_OVERSAMPLE        16           // hi-res mode samples this many times faster and boxcars back down (power of two)
+#define DECIMATE_ANTI_ALIAS     1            // 1 = slow timebases decimate through the CIC + FIR filter, 0 = boxcar
 
 #define DRAW_POINTS             HW_LCD_W   // 1 pixel per sample
 #define TIMER_RESOLUTION_HZ     1000000 // 1MHz timer resolution
-#define ALARM_INTERVAL_US       (TIMER_RESOLUTION_HZ / SAMPLE_RATE_HZ) // so at 10kHz, this is 100 us
 #define FRAME_PERIOD_MS         16 // 16 = 30FPS speed for cursor updates and waveform
+#define HEALTH_LOG_MS           1000 // how often lost sample counters are checked (logged only when they move)
+#define CORE_LOAD_LOG_MS        5000 // how often the per-core load is logged (needs FreeRTOS run time stats)
+
+//---------- Rate sweep ----------//
+// characterization: finds the highest stream rate that loses nothing, with and without the
+// display drawing, and logs it. runs at boot with RATE_SWEEP_AT_BOOT or SELECT held
+#define RATE_SWEEP_AT_BOOT      0
+#define RATE_SWEEP_STEPS        12   // geometric steps from the slowest stream rate up to the hardware max
+#define RATE_SWEEP_REFINE       4    // halvings between the last clean and the first lossy step
+#define RATE_SWEEP_SETTLE_MS    300  // after each rate change, before counting
+#define RATE_SWEEP_DWELL_MS     3000 // counted time at each rate
+
+//---------- Cores ----------//
+// acquisition (DMA stream, sample task: decimation, trigger, capture) runs on one core,
+// display and UI on the other. they only meet in the capture frames and a few atomics
+#define ACQ_CORE                1
+#define UI_CORE                 0 // app_main and the timer service task are pinned here in sdkconfig
 
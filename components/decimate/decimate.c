@@ -0,0 +1,158 @@
+#include "decimate.h"
+#include <stdbool.h>
+
+void decimate_boxcar_init(decimate_boxcar_t *d, uint32_t factor)
+{
+    uint32_t shift = 0;
+    while (shift < 8 && (2u << shift) <= factor) { shift++;}
+    d->factor = 1u << shift;
+    d->acc = 0;
+    d->count = 0;
+    // the sum of 2^shift samples already has shift extra bits
+    d->up = (shift < DECIMATE_FRAC_BITS) ? DECIMATE_FRAC_BITS - shift : 0;
+    d->down = (shift > DECIMATE_FRAC_BITS) ? shift - DECIMATE_FRAC_BITS : 0;
+}
+
+static inline uint16_t scale(const decimate_boxcar_t *d, uint32_t sum)
+{
+    if (d->down) { return (sum + (1u << (d->down - 1))) >> d->down;}
+    return sum << d->up;
+}
+
+size_t decimate_boxcar(decimate_boxcar_t *d, const uint16_t *in, size_t n, uint16_t *out)
+{
+    const uint32_t m = d->factor;
+    size_t out_n = 0;
+    size_t i = 0;
+
+    // finish the group left over from the last block
+    while (d->count != 0 && i < n) {
+        d->acc += in[i++];
+        if (++d->count == m) {
+            out[out_n++] = scale(d, d->acc);
+            d->acc = 0;
+            d->count = 0;
+        }
+    }
+
+    // whole groups straight out of the block, sum kept in a register
+    for (; i + m <= n; i += m) {
+        uint32_t sum = 0;
+        for (uint32_t k = 0; k < m; k++) { sum += in[i + k];}
+        out[out_n++] = scale(d, sum);
+    }
+
+    // start of the group that finishes in the next block
+    for (; i < n; i++) {
+        d->acc += in[i];
+        d->count++;
+    }
+    return out_n;
+}
+
+// compensation FIR, Q1.14, symmetric. least squares fit of 1 / CIC response over
+// [0, 0.25] of the output rate, plus a stopband weight over [0.42, 0.5]
+static const int16_t comp_taps[DECIMATE_COMP_TAPS] = {
+    1127, -3521, 3503, 14166, 3503, -3521, 1127,
+};
+
+void decimate_cic_init(decimate_cic_t *d, uint32_t factor)
+{
+    uint32_t shift = 1;
+    while (shift < 6 && (2u << shift) <= factor) { shift++;}
+    d->factor = 1u << shift;
+    d->count = 0;
+    for (int k = 0; k < DECIMATE_CIC_ORDER; k++) {
+        d->integ[k] = 0;
+        d->comb[k] = 0;
+    }
+    for (int k = 0; k < DECIMATE_COMP_TAPS; k++) { d->hist[k] = 0;}
+    // the CIC output has ORDER * shift extra bits
+    int grow = DECIMATE_CIC_ORDER * shift;
+    d->up = (grow < DECIMATE_FRAC_BITS) ? DECIMATE_FRAC_BITS - grow : 0;
+    d->down = (grow > DECIMATE_FRAC_BITS) ? grow - DECIMATE_FRAC_BITS : 0;
+}
+
+// combs on one integrator output, then one FIR output
+static inline uint16_t cic_output(decimate_cic_t *d, uint32_t v)
+{
+    for (int k = 0; k < DECIMATE_CIC_ORDER; k++) {
+        uint32_t prev = d->comb[k];
+        d->comb[k] = v;
+        v -= prev;
+    }
+    int32_t y = d->down ? (int32_t)((v + (1u << (d->down - 1))) >> d->down) : (int32_t)(v << d->up);
+
+    int32_t *h = d->hist;
+    for (int k = 0; k < DECIMATE_COMP_TAPS - 1; k++) { h[k] = h[k + 1];}
+    h[DECIMATE_COMP_TAPS - 1] = y;
+    int32_t acc = comp_taps[3] * h[3] + comp_taps[2] * (h[2] + h[4]) +
+                  comp_taps[1] * (h[1] + h[5]) + comp_taps[0] * (h[0] + h[6]);
+    acc = (acc + (1 << 13)) >> 14;
+    return (acc < 0) ? 0 : (acc > UINT16_MAX) ? UINT16_MAX : acc;
+}
+
+size_t decimate_cic(decimate_cic_t *d, const uint16_t *in, size_t n, uint16_t *out)
+{
+    const uint32_t m = d->factor;
+    uint32_t i0 = d->integ[0], i1 = d->integ[1], i2 = d->integ[2];
+    uint32_t count = d->count;
+    size_t out_n = 0;
+
+    // integrators in registers at the input rate, the rest once per output
+    for (size_t i = 0; i < n; i++) {
+        i0 += in[i];
+        i1 += i0;
+        i2 += i1;
+        if (++count == m) {
+            count = 0;
+            out[out_n++] = cic_output(d, i2);
+        }
+    }
+    d->integ[0] = i0;
+    d->integ[1] = i1;
+    d->integ[2] = i2;
+    d->count = count;
+    return out_n;
+}
+
+void decimate_peak_init(decimate_peak_t *d, uint32_t factor)
+{
+    uint32_t f = 2;
+    while (f < DECIMATE_PEAK_MAX_FACTOR && 2 * f <= factor) { f *= 2;}
+    d->factor = f;
+    d->count = 0;
+    d->min = UINT16_MAX;
+    d->max = 0;
+    d->min_at = d->max_at = 0;
+}
+
+size_t decimate_peak(decimate_peak_t *d, const uint16_t *in, size_t n, uint16_t *out)
+{
+    // group state in registers for the block, written back at the end
+    const uint32_t m = d->factor;
+    uint32_t count = d->count, min_at = d->min_at, max_at = d->max_at;
+    uint16_t min = d->min, max = d->max;
+    size_t out_n = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        uint16_t v = in[i];
+        if (v < min) { min = v; min_at = count;}
+        if (v > max) { max = v; max_at = count;}
+        if (++count == m) {
+            bool min_first = min_at <= max_at;
+            out[out_n++] = min_first ? min : max;
+            out[out_n++] = min_first ? max : min;
+            count = 0;
+            min = UINT16_MAX;
+            max = 0;
+        }
+    }
+
+    d->count = count;
+    d->min = min;
+    d->max = max;
+    d->min_at = min_at;
+    d->max_at = max_at;
+    return out_n;
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Streaming decimation stages between the adc_stream blocks and the capture store.
+// state carries across calls, so blocks can be fed in as they come and a group
+// that straddles two blocks is still averaged as one.
+
+#define DECIMATE_FRAC_BITS      4   // hi-res output: 12 bit code with 4 extra bits below it (Q12.4)
+#define DECIMATE_MAX_FACTOR     256
+#define DECIMATE_CIC_ORDER      3   // decimate_cic() has the integrators written out for 3
+#define DECIMATE_CIC_MAX_FACTOR 64  // 12 + 3 * log2(64) = 30 bits, the integrators fit 32 bit words
+#define DECIMATE_COMP_TAPS      7
+#define DECIMATE_PEAK_MAX_FACTOR (2 * DECIMATE_MAX_FACTOR)
+
+// boxcar: mean of every factor consecutive samples
+typedef struct {
+    uint32_t factor;        // power of two
+    uint32_t acc;           // sum of the group in progress
+    uint32_t count;         // samples in the group in progress
+    int up;                 // group sum -> Q12.4: << up, or >> down
+    int down;
+} decimate_boxcar_t;
+
+// factor is rounded down to a power of two in [1, DECIMATE_MAX_FACTOR]
+void decimate_boxcar_init(decimate_boxcar_t *d, uint32_t factor);
+
+// feeds n raw 12 bit samples, writes one Q12.4 sample per completed group to out
+// (room for n / factor + 1). returns the number written
+size_t decimate_boxcar(decimate_boxcar_t *d, const uint16_t *in, size_t n, uint16_t *out);
+
+// samples of the group in progress (they belong to the next output sample)
+static inline uint32_t decimate_boxcar_pending(const decimate_boxcar_t *d)
+{
+    return d->count;
+}
+
+// anti-alias decimator: CIC (integrators at the input rate, combs at the output rate)
+// followed by a short FIR at the output rate that flattens the CIC's passband droop.
+// within 0.5 dB up to a quarter of the output rate, 20 dB or more down from 0.42 of it up to
+// its Nyquist (40 dB around 0.45). whatever would fold into that flat quarter is 27 dB down
+typedef struct {
+    uint32_t factor;        // power of two
+    uint32_t integ[DECIMATE_CIC_ORDER];  // wrap around on purpose, the combs undo it
+    uint32_t comb[DECIMATE_CIC_ORDER];   // previous input of each comb stage
+    uint32_t count;         // input samples into the output in progress
+    int up;                 // CIC output (gain factor^ORDER) -> Q12.4: << up, or >> down
+    int down;
+    int32_t hist[DECIMATE_COMP_TAPS];    // recent CIC outputs, Q12.4, for the FIR
+} decimate_cic_t;
+
+// factor is rounded down to a power of two in [2, DECIMATE_CIC_MAX_FACTOR]
+void decimate_cic_init(decimate_cic_t *d, uint32_t factor);
+
+// feeds n raw 12 bit samples, writes one Q12.4 sample per factor inputs to out
+// (room for n / factor + 1). returns the number written
+size_t decimate_cic(decimate_cic_t *d, const uint16_t *in, size_t n, uint16_t *out);
+
+// input samples of the output in progress
+static inline uint32_t decimate_cic_pending(const decimate_cic_t *d)
+{
+    return d->count;
+}
+
+// how many input samples later than a boxcar output (stamped at the first sample of its
+// group) an output comes out: the CIC's extra group delay plus the FIR's
+static inline uint32_t decimate_cic_delay(const decimate_cic_t *d)
+{
+    return (DECIMATE_CIC_ORDER - 1) * (d->factor - 1) / 2 + (DECIMATE_COMP_TAPS / 2) * d->factor;
+}
+
+// peak detect: smallest and largest of every factor consecutive samples, written as two
+// raw 12 bit samples in the order they came. two outputs per group, so a factor of 2 * m
+// gives the same output rate as an m boxcar, and a one sample glitch anywhere in the
+// group is still one of them
+typedef struct {
+    uint32_t factor;        // power of two
+    uint32_t count;         // samples in the group in progress
+    uint16_t min;           // of the group in progress
+    uint16_t max;
+    uint32_t min_at;        // where in the group they were
+    uint32_t max_at;
+} decimate_peak_t;
+
+// factor is rounded down to a power of two in [2, DECIMATE_PEAK_MAX_FACTOR]
+void decimate_peak_init(decimate_peak_t *d, uint32_t factor);
+
+// feeds n raw 12 bit samples, writes a min / max pair per completed group to out
+// (room for 2 * (n / factor + 1)). returns the number written
+size_t decimate_peak(decimate_peak_t *d, const uint16_t *in, size_t n, uint16_t *out);
+
+// samples of the group in progress (they belong to the next pair)
+static inline uint32_t decimate_peak_pending(const decimate_peak_t *d)
+{
+    return d->count;
+}
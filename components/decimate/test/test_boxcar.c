@@ -0,0 +1,143 @@
+#include "decimate.h"
+#include "host_test.h"
+#include <math.h>
+#include <string.h>
+
+// hi-res boxcar: unity gain into Q12.4 for every factor, the exact group mean whatever
+// the block boundaries, and white noise down by sqrt(factor) (half a bit per 4x). also
+// times the boxcar per input sample at each factor
+
+#define N       (1 << 18)
+#define FS      160000.0
+#define SIGMA   1.0     // input noise, LSB rms
+#define BENCH_REP   100
+
+static uint16_t in[N];
+static uint16_t out[N + 1];
+static uint16_t out2[N + 1];
+static double ideal[N];
+
+// reproducible gaussian noise (sum of 12 uniforms)
+static uint32_t rng = 1;
+static double gauss(void)
+{
+    double g = 0;
+    for (int k = 0; k < 12; k++) {
+        rng = rng * 1664525u + 1013904223u;
+        g += (rng >> 8) / 16777216.0;
+    }
+    return g - 6;
+}
+
+// constant input comes out as code << DECIMATE_FRAC_BITS at every factor
+static void gain(void)
+{
+    uint16_t codes[] = { 0, 1, 2047, 2048, 4095 };
+    for (uint32_t m = 1; m <= DECIMATE_MAX_FACTOR; m *= 2) {
+        for (int c = 0; c < 5; c++) {
+            for (int i = 0; i < 1024; i++) { in[i] = codes[c];}
+            decimate_boxcar_t d;
+            decimate_boxcar_init(&d, m);
+            size_t n = decimate_boxcar(&d, in, 1024, out);
+            CHECK(n == 1024 / m);
+            for (size_t k = 0; k < n; k++) {
+                if (out[k] != codes[c] << DECIMATE_FRAC_BITS) {
+                    CHECK(out[k] == codes[c] << DECIMATE_FRAC_BITS);
+                    break;
+                }
+            }
+        }
+    }
+    // factors round down to a power of two
+    decimate_boxcar_t d;
+    decimate_boxcar_init(&d, 24);
+    CHECK(d.factor == 16);
+    decimate_boxcar_init(&d, 100000);
+    CHECK(d.factor == DECIMATE_MAX_FACTOR);
+}
+
+// every output is the mean of its group in Q12.4 (rounded to nearest once below 1/16 LSB),
+// the same for any block size
+static void exact_mean(void)
+{
+    for (int i = 0; i < N; i++) { in[i] = (i * 2654435761u) >> 20;}
+    for (uint32_t m = 2; m <= DECIMATE_MAX_FACTOR; m *= 2) {
+        decimate_boxcar_t d;
+        decimate_boxcar_init(&d, m);
+        size_t n = decimate_boxcar(&d, in, N, out);
+        CHECK(n == N / m);
+        int bad = 0;
+        for (size_t k = 0; k < n; k++) {
+            uint32_t sum = 0;
+            for (uint32_t j = 0; j < m; j++) { sum += in[k * m + j];}
+            if (out[k] != ((sum << DECIMATE_FRAC_BITS) + m / 2) / m) { bad++;}
+        }
+        CHECK(bad == 0);
+
+        // groups straddling blocks of an awkward size
+        decimate_boxcar_init(&d, m);
+        size_t n2 = 0;
+        for (size_t at = 0; at < N; at += 37) { n2 += decimate_boxcar(&d, in + at, N - at < 37 ? N - at : 37, out2 + n2);}
+        CHECK(n2 == n);
+        CHECK(memcmp(out, out2, n * sizeof(out[0])) == 0);
+        CHECK(decimate_boxcar_pending(&d) == N % m);
+    }
+}
+
+// sine plus SIGMA LSB of noise: residual against the noiseless group mean
+static void noise(void)
+{
+    double f = 37.3;
+    for (int i = 0; i < N; i++) {
+        ideal[i] = 2048 + 1800 * sin(2 * M_PI * f * i / FS);
+        long q = lround(ideal[i] + gauss() * SIGMA);
+        in[i] = q < 0 ? 0 : q > 4095 ? 4095 : q;
+    }
+    // what one sample carries: the noise plus the quantisation
+    double in_rms = sqrt(SIGMA * SIGMA + 1.0 / 12);
+    for (uint32_t m = 1; m <= 64; m *= 4) {
+        decimate_boxcar_t d;
+        decimate_boxcar_init(&d, m);
+        size_t n = 0;
+        for (int i = 0; i < N; i += 256) { n += decimate_boxcar(&d, in + i, 256, out + n);}
+        double e = 0;
+        for (size_t k = 0; k < n; k++) {
+            double mean = 0;
+            for (uint32_t j = 0; j < m; j++) { mean += ideal[k * m + j];}
+            double dv = out[k] / (double)(1 << DECIMATE_FRAC_BITS) - mean / m;
+            e += dv * dv;
+        }
+        double rms = sqrt(e / n);
+        // averaging m samples, plus the Q12.4 output's own rounding
+        double want = sqrt(in_rms * in_rms / m + 1.0 / (12.0 * 256));
+        double enob = log2(4096 / (rms * sqrt(12)));
+        printf("factor %2u: residual %.3f LSB rms (expected %.3f), %.2f effective bits\n", m, rms, want, enob);
+        CHECK_NEAR(rms, want, want * 0.05);
+    }
+}
+
+// ns per input sample, fed in 256 sample blocks like the stream delivers them
+static void speed(void)
+{
+    for (int i = 0; i < N; i++) { in[i] = (i * 2654435761u) >> 20;}
+    for (uint32_t m = 1; m <= DECIMATE_MAX_FACTOR; m *= 2) {
+        decimate_boxcar_t d;
+        decimate_boxcar_init(&d, m);
+        double t = host_test_now();
+        for (int r = 0; r < BENCH_REP; r++) {
+            size_t n = 0;
+            for (int i = 0; i < N; i += 256) { n += decimate_boxcar(&d, in + i, 256, out + n);}
+        }
+        double dt = host_test_now() - t;
+        printf("factor %3u: %.3f ns/sample\n", m, dt * 1e9 / N / BENCH_REP);
+    }
+}
+
+int main(void)
+{
+    gain();
+    exact_mean();
+    noise();
+    speed();
+    return HOST_TEST_RESULT();
+}
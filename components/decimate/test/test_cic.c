@@ -0,0 +1,148 @@
+#include "decimate.h"
+#include "host_test.h"
+#include <complex.h>
+#include <math.h>
+#include <stdbool.h>
+#include <string.h>
+
+// anti-alias decimator: unity DC gain into Q12.4, flat (0.5 dB) up to a quarter of the
+// output rate, 20 dB down from 0.42 of it, and input above the output Nyquist that would
+// fold into the flat quarter held 27 dB down, far below what the plain boxcar lets through.
+// frequencies are in units of the output rate. also times the CIC + FIR per input sample
+// against the boxcar
+
+#define N       (1 << 17)
+#define AMP     1000.0
+#define SETTLE  16      // outputs skipped while the filters fill
+#define BENCH_REP   50
+
+static uint16_t in[N];
+static uint16_t out[N];
+static uint16_t out2[N];
+
+// sine of f cycles per input sample through the CIC (or the boxcar). returns its complex
+// gain, read off the output samples at the input instants they stand for: the phase is
+// against where decimate_cic_delay says an output sits. a tone above the output Nyquist
+// reads as the alias it folds into
+static double complex response(bool cic, uint32_t r, double f)
+{
+    for (int i = 0; i < N; i++) { in[i] = lround(2048 + AMP * sin(2 * M_PI * f * i));}
+    size_t n;
+    double lag;
+    if (cic) {
+        decimate_cic_t d;
+        decimate_cic_init(&d, r);
+        n = decimate_cic(&d, in, N, out);
+        lag = decimate_cic_delay(&d);
+    } else {
+        decimate_boxcar_t d;
+        decimate_boxcar_init(&d, r);
+        n = decimate_boxcar(&d, in, N, out);
+        lag = 0;
+    }
+    // a boxcar output is centred (r - 1) / 2 into its group, the CIC lag samples after that
+    double complex acc = 0;
+    int m = 0;
+    for (size_t k = SETTLE; k < n; k++) {
+        double t = k * r + (r - 1) / 2.0 - lag;
+        double v = out[k] / (double)(1 << DECIMATE_FRAC_BITS) - 2048;
+        acc += v * cexp(-I * 2 * M_PI * f * t);
+        m++;
+    }
+    // sin = (e^jx - e^-jx) / 2j, the e^-jx half averages out
+    return 2 * I * acc / m / AMP;
+}
+
+static double db(double complex g)
+{
+    return 20 * log10(cabs(g) + 1e-12);
+}
+
+static void dc_and_blocks(void)
+{
+    for (uint32_t r = 2; r <= DECIMATE_CIC_MAX_FACTOR; r *= 2) {
+        for (int i = 0; i < N; i++) { in[i] = 3000;}
+        decimate_cic_t d;
+        decimate_cic_init(&d, r);
+        size_t n = decimate_cic(&d, in, N, out);
+        CHECK(n == N / r);
+        CHECK(out[n - 1] == 3000 << DECIMATE_FRAC_BITS);
+
+        // any block size gives the same outputs
+        for (int i = 0; i < N; i++) { in[i] = (i * 2654435761u) >> 20;}
+        decimate_cic_init(&d, r);
+        n = decimate_cic(&d, in, N, out);
+        decimate_cic_init(&d, r);
+        size_t n2 = 0;
+        for (size_t at = 0; at < N; at += 37) { n2 += decimate_cic(&d, in + at, N - at < 37 ? N - at : 37, out2 + n2);}
+        CHECK(n2 == n);
+        CHECK(memcmp(out, out2, n * sizeof(out[0])) == 0);
+    }
+}
+
+static void passband_and_alias(uint32_t r)
+{
+    printf("factor %u      passband dB       alias from (1 - f) dB\n", r);
+    printf("   f        boxcar  cic+fir        boxcar  cic+fir\n");
+    double worst_pass = 0, worst_alias = -1000, worst_phase = 0;
+    for (double fo = 0.025; fo <= 0.25 + 1e-9; fo += 0.025) {
+        double complex c = response(true, r, fo / r);
+        double b = db(response(false, r, fo / r));
+        // a tone at 1 - fo folds onto fo
+        double ca = db(response(true, r, (1 - fo) / r));
+        double ba = db(response(false, r, (1 - fo) / r));
+        printf("  %.3f  %8.2f %8.2f      %8.2f %8.2f\n", fo, b, db(c), ba, ca);
+        if (fabs(db(c)) > worst_pass) { worst_pass = fabs(db(c));}
+        if (ca > worst_alias) { worst_alias = ca;}
+        if (fabs(carg(c)) > worst_phase) { worst_phase = fabs(carg(c));}
+        // folds in at least 15 dB below the boxcar's
+        CHECK(ca < ba - 15);
+    }
+    double worst_stop = -1000;
+    for (double fo = 0.42; fo <= 0.5; fo += 0.01) {
+        double s = db(response(true, r, fo / r));
+        if (s > worst_stop) { worst_stop = s;}
+    }
+    printf("  passband within %.2f dB, phase within %.3f rad, aliases at most %.1f dB, 0.42-0.5 at most %.1f dB\n",
+           worst_pass, worst_phase, worst_alias, worst_stop);
+    CHECK(worst_pass <= 0.5);
+    // the delay decimate_cic_delay reports is where the output really sits
+    CHECK(worst_phase < 0.02);
+    CHECK(worst_alias <= -27);
+    CHECK(worst_stop <= -19.5);
+}
+
+// ns per input sample at each factor, both fed in 256 sample blocks like the stream
+static void speed(void)
+{
+    for (int i = 0; i < N; i++) { in[i] = (i * 2654435761u) >> 20;}
+    for (uint32_t r = 2; r <= DECIMATE_CIC_MAX_FACTOR; r *= 2) {
+        decimate_cic_t c;
+        decimate_cic_init(&c, r);
+        double t = host_test_now();
+        for (int k = 0; k < BENCH_REP; k++) {
+            size_t n = 0;
+            for (int i = 0; i < N; i += 256) { n += decimate_cic(&c, in + i, 256, out + n);}
+        }
+        double tc = host_test_now() - t;
+        decimate_boxcar_t b;
+        decimate_boxcar_init(&b, r);
+        t = host_test_now();
+        for (int k = 0; k < BENCH_REP; k++) {
+            size_t n = 0;
+            for (int i = 0; i < N; i += 256) { n += decimate_boxcar(&b, in + i, 256, out + n);}
+        }
+        double tb = host_test_now() - t;
+        printf("factor %3u: cic+fir %.3f ns/sample, boxcar %.3f ns/sample\n", r,
+               tc * 1e9 / N / BENCH_REP, tb * 1e9 / N / BENCH_REP);
+    }
+}
+
+int main(void)
+{
+    dc_and_blocks();
+    passband_and_alias(4);
+    passband_and_alias(32);
+    speed();
+    return HOST_TEST_RESULT();
+}
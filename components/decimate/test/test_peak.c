@@ -0,0 +1,114 @@
+#include "decimate.h"
+#include "capture.h"
+#include "trigger.h"
+#include "config.h"
+#include "host_test.h"
+#include <string.h>
+
+// peak detect decimation: each group comes out as its min and max in the order they came,
+// the same for any block size, and a one sample spike fed through a 2^k times faster stream
+// still reaches the screen column over it when the record is bucketed the way the renderer
+// does it (the boxcar in its place averages the spike away)
+
+#define COLS        HW_LCD_W
+#define OUT_LEN     (COLS * SAMPLES_PER_COLUMN)     // one screen of output samples
+#define MAX_SHIFT   8
+#define BASE        2048
+#define SPIKE       4000
+
+static uint16_t in[OUT_LEN << MAX_SHIFT];
+static uint16_t out[OUT_LEN + 2];
+static uint16_t out2[OUT_LEN + 2];
+
+static void pairs(void)
+{
+    decimate_peak_t d;
+    // 4 sample groups: max before min, min before max, flat
+    uint16_t s[] = { 10, 90, 5, 20,   1, 2, 3, 4,   7, 7, 7, 7,   50 };
+    decimate_peak_init(&d, 4);
+    size_t n = decimate_peak(&d, s, 13, out);
+    CHECK(n == 6);
+    CHECK(out[0] == 90 && out[1] == 5);
+    CHECK(out[2] == 1 && out[3] == 4);
+    CHECK(out[4] == 7 && out[5] == 7);
+    CHECK(decimate_peak_pending(&d) == 1);
+
+    // factors round down to a power of two, 2 at least
+    decimate_peak_init(&d, 1);
+    CHECK(d.factor == 2);
+    decimate_peak_init(&d, 24);
+    CHECK(d.factor == 16);
+    decimate_peak_init(&d, 1u << 20);
+    CHECK(d.factor == DECIMATE_PEAK_MAX_FACTOR);
+
+    // any block size gives the same outputs
+    for (uint32_t i = 0; i < OUT_LEN * 8; i++) { in[i] = (i * 2654435761u) >> 20;}
+    decimate_peak_init(&d, 16);
+    n = decimate_peak(&d, in, OUT_LEN * 8, out);
+    decimate_peak_init(&d, 16);
+    size_t n2 = 0;
+    for (size_t at = 0; at < OUT_LEN * 8; at += 37) {
+        n2 += decimate_peak(&d, in + at, OUT_LEN * 8 - at < 37 ? OUT_LEN * 8 - at : 37, out2 + n2);
+    }
+    CHECK(n2 == n && n == OUT_LEN);
+    CHECK(memcmp(out, out2, n * sizeof(out[0])) == 0);
+}
+
+// columns over a screen of output samples like draw_record buckets them: true if the one
+// whose span holds output sample j shows a sample of value v (Q frac_bits)
+static bool column_shows(const uint16_t *s, uint32_t j, uint16_t v, int frac_bits, uint16_t *seen)
+{
+    capture_view_t view = { (uint16_t *)s, OUT_LEN, 0, OUT_LEN };
+    int32_t step = (int32_t)(((OUT_LEN - 1) << TRIGGER_FRAC_BITS) / (COLS - 1));
+    bool shown = false;
+    *seen = 0;
+    for (int x = 0; x < COLS; x++) {
+        uint32_t idx = (x * step) >> TRIGGER_FRAC_BITS;
+        uint32_t next = (x * step + step) >> TRIGGER_FRAC_BITS;
+        if (idx > j + 1 || next < j) { continue;}
+        uint16_t lo, hi;
+        capture_view_minmax(&view, idx, next - idx + 1, &lo, &hi);
+        if (hi > *seen) { *seen = hi;}
+        shown |= (hi >> frac_bits) == v;
+    }
+    return shown;
+}
+
+// stream 2^shift times faster than the display rate, one sample spiking at each of a spread
+// of positions, fed in stream sized blocks
+static void spike(uint32_t shift)
+{
+    uint32_t len = OUT_LEN << shift;
+    int missed = 0;
+    uint16_t boxcar_best = 0;
+    for (uint32_t p = 7; p < len; p += len / 61) {
+        for (uint32_t i = 0; i < len; i++) { in[i] = BASE;}
+        in[p] = SPIKE;
+
+        decimate_peak_t d;
+        decimate_peak_init(&d, 2u << shift);
+        size_t n = 0;
+        for (uint32_t at = 0; at < len; at += 256) { n += decimate_peak(&d, in + at, 256, out + n);}
+        CHECK(n == OUT_LEN);
+        uint16_t seen;
+        // the pair of the spike's group sits where the group's time is
+        if (!column_shows(out, 2 * (p / d.factor), SPIKE, 0, &seen)) { missed++;}
+
+        decimate_boxcar_t b;
+        decimate_boxcar_init(&b, 1u << shift);
+        n = 0;
+        for (uint32_t at = 0; at < len; at += 256) { n += decimate_boxcar(&b, in + at, 256, out + n);}
+        column_shows(out, p >> shift, SPIKE, DECIMATE_FRAC_BITS, &seen);
+        if (seen > boxcar_best) { boxcar_best = seen;}
+    }
+    printf("%3ux stream: %d spikes missed, boxcar shows them at most %u\n", 1u << shift, missed,
+           boxcar_best >> DECIMATE_FRAC_BITS);
+    CHECK(missed == 0);
+}
+
+int main(void)
+{
+    pairs();
+    for (uint32_t shift = 1; shift <= MAX_SHIFT; shift++) { spike(shift);}
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,83 @@
+#include "interleave.h"
+#include <math.h>
+
+#define GAIN_ONE    (1 << INTERLEAVE_GAIN_BITS)
+#define CHUNK_PAIRS 256     // 256 squares of 12 bit codes still fit a 32 bit sum
+
+void interleave_cal_reset(interleave_cal_t *cal)
+{
+    for (int p = 0; p < INTERLEAVE_PATHS; p++) {
+        cal->gain[p] = GAIN_ONE;
+        cal->offset[p] = GAIN_ONE / 2;
+    }
+}
+
+void interleave_stats_reset(interleave_stats_t *st)
+{
+    for (int p = 0; p < INTERLEAVE_PATHS; p++) {
+        st->sum[p] = 0;
+        st->sq[p] = 0;
+        st->n[p] = 0;
+    }
+}
+
+void interleave_stats_add(interleave_stats_t *st, const uint16_t *samples, size_t n)
+{
+    size_t pairs = n / 2;
+    while (pairs > 0) {
+        // 32 bit sums in registers for a chunk, folded into the 64 bit totals after
+        size_t m = (pairs > CHUNK_PAIRS) ? CHUNK_PAIRS : pairs;
+        uint32_t s0 = 0, s1 = 0, q0 = 0, q1 = 0;
+        for (size_t i = 0; i < m; i++) {
+            uint32_t a = samples[2 * i];
+            uint32_t b = samples[2 * i + 1];
+            s0 += a;
+            s1 += b;
+            q0 += a * a;
+            q1 += b * b;
+        }
+        st->sum[0] += s0;
+        st->sum[1] += s1;
+        st->sq[0] += q0;
+        st->sq[1] += q1;
+        st->n[0] += m;
+        st->n[1] += m;
+        samples += 2 * m;
+        pairs -= m;
+    }
+}
+
+bool interleave_cal_estimate(const interleave_stats_t *st, interleave_cal_t *cal)
+{
+    double mean[INTERLEAVE_PATHS], sd[INTERLEAVE_PATHS];
+    for (int p = 0; p < INTERLEAVE_PATHS; p++) {
+        if (st->n[p] == 0) { return false;}
+        mean[p] = (double)st->sum[p] / st->n[p];
+        double var = (double)st->sq[p] / st->n[p] - mean[p] * mean[p];
+        sd[p] = (var > 0.0) ? sqrt(var) : 0.0;
+    }
+
+    // both paths are pulled onto the average of the two, so neither one is the reference
+    double target_mean = (mean[0] + mean[1]) / 2.0;
+    double target_sd = (sd[0] + sd[1]) / 2.0;
+    bool gains = sd[0] >= INTERLEAVE_MIN_SPREAD && sd[1] >= INTERLEAVE_MIN_SPREAD;
+    for (int p = 0; p < INTERLEAVE_PATHS; p++) {
+        double g = gains ? target_sd / sd[p] : 1.0;
+        // out = (in - mean) * g + target_mean, folded into one multiply-add
+        cal->gain[p] = (int32_t)lround(g * GAIN_ONE);
+        cal->offset[p] = (int32_t)lround((target_mean - mean[p] * g) * GAIN_ONE) + GAIN_ONE / 2;
+    }
+    return true;
+}
+
+void interleave_correct(const interleave_cal_t *cal, uint16_t *samples, size_t n)
+{
+    const int32_t g0 = cal->gain[0], g1 = cal->gain[1];
+    const int32_t o0 = cal->offset[0], o1 = cal->offset[1];
+    for (size_t i = 0; i + 1 < n; i += 2) {
+        int32_t a = (samples[i] * g0 + o0) >> INTERLEAVE_GAIN_BITS;
+        int32_t b = (samples[i + 1] * g1 + o1) >> INTERLEAVE_GAIN_BITS;
+        samples[i] = (a < 0) ? 0 : (a > 4095) ? 4095 : a;
+        samples[i + 1] = (b < 0) ? 0 : (b > 4095) ? 4095 : b;
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Time-interleaved sampling: two converter paths take turns on the same input, half a
+// sample period of the merged stream apart, and the merged stream alternates between
+// them (even samples from path 0, odd from path 1). any offset or gain difference
+// between the paths shows up as a spur at fs/2 and an image of the signal at fs/2 - f.
+// the correction maps each path onto the average of the two.
+
+#define INTERLEAVE_PATHS        2
+#define INTERLEAVE_GAIN_BITS    14  // gains are Q2.14
+#define INTERLEAVE_MIN_SPREAD   8   // raw codes of standard deviation below which a gain isn't estimated
+
+// per path correction: out = (in * gain + offset) >> INTERLEAVE_GAIN_BITS
+typedef struct {
+    int32_t gain[INTERLEAVE_PATHS];
+    int32_t offset[INTERLEAVE_PATHS];   // includes the rounding half
+} interleave_cal_t;
+
+// running sums of a calibration capture, per path
+typedef struct {
+    uint64_t sum[INTERLEAVE_PATHS];
+    uint64_t sq[INTERLEAVE_PATHS];
+    uint32_t n[INTERLEAVE_PATHS];
+} interleave_stats_t;
+
+// identity correction
+void interleave_cal_reset(interleave_cal_t *cal);
+
+void interleave_stats_reset(interleave_stats_t *st);
+
+// adds n merged raw samples (sample 0 from path 0) to the calibration sums
+void interleave_stats_add(interleave_stats_t *st, const uint16_t *samples, size_t n);
+
+// turns the sums into a correction. offsets always, gains only when both paths saw
+// enough signal (INTERLEAVE_MIN_SPREAD), otherwise they stay at 1. the input needs to
+// look the same to both paths on average: anything not locked to fs/2 does.
+// false if the sums are empty and cal was left alone
+bool interleave_cal_estimate(const interleave_stats_t *st, interleave_cal_t *cal);
+
+// corrects n merged raw 12 bit samples in place (sample 0 from path 0, n even), clamped
+// to the 12 bit range
+void interleave_correct(const interleave_cal_t *cal, uint16_t *samples, size_t n);
@@ -0,0 +1,75 @@
+#include "interp.h"
+#include <math.h>
+
+#define NUM_PHASES  (1 << INTERP_PHASE_BITS)
+#define HALF_TAPS   (INTERP_TAPS / 2)
+
+// coef[p][k] weighs sample (i - HALF_TAPS + 1 + k) for a position p / NUM_PHASES past sample i
+static int16_t coef[NUM_PHASES][INTERP_TAPS];
+
+static double lanczos(double x)
+{
+    if (x == 0.0) { return 1.0;}
+    if (fabs(x) >= HALF_TAPS) { return 0.0;}
+    double px = M_PI * x;
+    return HALF_TAPS * sin(px) * sin(px / HALF_TAPS) / (px * px);
+}
+
+void interp_init(void)
+{
+    for (int p = 0; p < NUM_PHASES; p++) {
+        double t = (double)p / NUM_PHASES;
+        double h[INTERP_TAPS];
+        double sum = 0.0;
+        for (int k = 0; k < INTERP_TAPS; k++) {
+            h[k] = lanczos(k - HALF_TAPS + 1 - t);
+            sum += h[k];
+        }
+        // each phase sums to exactly one, so flat parts of the trace stay flat. the rounding
+        // error goes on the biggest tap
+        int32_t total = 0;
+        int big = 0;
+        for (int k = 0; k < INTERP_TAPS; k++) {
+            coef[p][k] = (int16_t)lround(h[k] / sum * (1 << INTERP_COEF_BITS));
+            total += coef[p][k];
+            if (coef[p][k] > coef[p][big]) { big = k;}
+        }
+        coef[p][big] += (1 << INTERP_COEF_BITS) - total;
+    }
+}
+
+// sample i of the view, the end samples repeated past either end
+static inline int32_t tap(const capture_view_t *view, int32_t i)
+{
+    if (i < 0) { i = 0;}
+    if (i >= (int32_t)view->len) { i = view->len - 1;}
+    return capture_view_at(view, i);
+}
+
+int32_t interp_at(const capture_view_t *view, uint32_t pos, interp_kind_t kind)
+{
+    int32_t i = pos >> INTERP_FRAC_BITS;
+    uint32_t frac = pos & ((1u << INTERP_FRAC_BITS) - 1);
+
+    if (kind == INTERP_LINEAR) {
+        int32_t s0 = tap(view, i);
+        return s0 + (((tap(view, i + 1) - s0) * (int32_t)frac) >> INTERP_FRAC_BITS);
+    }
+
+    // nearest table phase, rounding up into the next sample's phase 0
+    uint32_t p = (frac + (1u << (INTERP_FRAC_BITS - INTERP_PHASE_BITS - 1))) >> (INTERP_FRAC_BITS - INTERP_PHASE_BITS);
+    if (p == NUM_PHASES) {
+        p = 0;
+        i++;
+    }
+    const int16_t *c = coef[p];
+    int32_t first = i - HALF_TAPS + 1;
+    int32_t acc = 0;
+    if (first >= 0 && first + INTERP_TAPS <= (int32_t)view->len) {
+        // whole window inside the record, no end checks
+        for (int k = 0; k < INTERP_TAPS; k++) { acc += c[k] * (int32_t)capture_view_at(view, first + k);}
+    } else {
+        for (int k = 0; k < INTERP_TAPS; k++) { acc += c[k] * tap(view, first + k);}
+    }
+    return (acc + (1 << (INTERP_COEF_BITS - 1))) >> INTERP_COEF_BITS;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdint.h>
+#include "capture.h"
+
+// Horizontal upsampling for the renderer: the value of a record between its samples,
+// for timebases that have fewer samples than screen columns. works on any capture
+// view, in the view's own sample format (plain codes or hi-res)
+
+#define INTERP_FRAC_BITS    8   // positions are samples << INTERP_FRAC_BITS, like the renderer's (TRIGGER_FRAC_BITS)
+#define INTERP_PHASE_BITS   5   // sinc table resolution: 32 phases per sample
+#define INTERP_TAPS         8   // sinc taps per phase, half of them each side of the position
+#define INTERP_COEF_BITS    14  // sinc coefficients are Q1.14
+
+typedef enum {
+    INTERP_LINEAR,  // straight line between the two neighbouring samples
+    INTERP_SINC,    // Lanczos windowed sin(x)/x, band limited reconstruction
+    NUM_INTERP_KINDS
+} interp_kind_t;
+
+// fills the polyphase sinc table. call once before interp_at with INTERP_SINC
+void interp_init(void);
+
+// record value at pos (samples << INTERP_FRAC_BITS). taps past either end of the view
+// repeat the end sample. sinc can ring past the input range, so the result is signed
+int32_t interp_at(const capture_view_t *view, uint32_t pos, interp_kind_t kind);
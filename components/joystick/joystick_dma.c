@@ -12,6 +12,9 @@ static int baseline_x = 2000;
 static int baseline_y = 2000;
 static float filt_x = 2000;
 static float filt_y = 2000;
+// latest raw readings, pushed in from the adc_stream scan once sampling runs
+static volatile int feed_x = 2000;
+static volatile int feed_y = 2000;
 
 static int normalize(int raw, int base)
 {
@@ -25,10 +28,9 @@ static int normalize(int raw, int base)
 
 static void joystick_task(void *arg)
 {
-    int raw_x, raw_y;
     while (1) {
-        adc_oneshot_read(adc_handle, ADC_CHANNEL_6, &raw_x);
-        adc_oneshot_read(adc_handle, ADC_CHANNEL_7, &raw_y);
+        int raw_x = feed_x;
+        int raw_y = feed_y;
         // low-pass filtering
         filt_x = filt_x + AVG_ALPHA * (raw_x - filt_x);
         filt_y = filt_y + AVG_ALPHA * (raw_y - filt_y);
@@ -49,16 +51,16 @@ void joystick_init(void)
         .atten = ADC_ATTEN_DB_12
     };
 
-    ESP_ERROR_CHECK(adc_oneshot_config_channel(adc_handle, ADC_CHANNEL_6, &cfg));
-    ESP_ERROR_CHECK(adc_oneshot_config_channel(adc_handle, ADC_CHANNEL_7, &cfg));
+    ESP_ERROR_CHECK(adc_oneshot_config_channel(adc_handle, ADC_JOY_X_CHANNEL, &cfg));
+    ESP_ERROR_CHECK(adc_oneshot_config_channel(adc_handle, ADC_JOY_Y_CHANNEL, &cfg));
 
     // center calibration for joystick using multiple samples
     baseline_x = 0;
     baseline_y = 0;
     for (int i = 0; i < 25; i++) {
         int raw_x, raw_y;
-        adc_oneshot_read(adc_handle, ADC_CHANNEL_6, &raw_x);
-        adc_oneshot_read(adc_handle, ADC_CHANNEL_7, &raw_y);
+        adc_oneshot_read(adc_handle, ADC_JOY_X_CHANNEL, &raw_x);
+        adc_oneshot_read(adc_handle, ADC_JOY_Y_CHANNEL, &raw_y);
         baseline_x += raw_x;
         baseline_y += raw_y;
         vTaskDelay(pdMS_TO_TICKS(5));
@@ -66,8 +68,19 @@ void joystick_init(void)
     baseline_x /= 25;
     baseline_y /= 25;
     ESP_LOGI(TAG, "Joystick baseline set: X=%d Y=%d", baseline_x, baseline_y);
+    feed_x = filt_x = baseline_x;
+    feed_y = filt_y = baseline_y;
+
+    // ADC1 belongs to the continuous (DMA) stream from here on, so give up the oneshot unit
+    ESP_ERROR_CHECK(adc_oneshot_del_unit(adc_handle));
     
-    xTaskCreate(joystick_task, "joystick_task", 2048, NULL, 1, NULL);
+    xTaskCreatePinnedToCore(joystick_task, "joystick_task", 2048, NULL, 1, NULL, UI_CORE);
+}
+
+void joystick_feed_raw(int raw_x, int raw_y)
+{
+    feed_x = raw_x;
+    feed_y = raw_y;
 }
 
 void joystick_read(joystick_pos_t *pos)
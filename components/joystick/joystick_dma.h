@@ -10,5 +10,8 @@ typedef struct {
 // to initialize and setup the joystick
 void joystick_init(void);
 
+// to hand over the latest raw axis readings (sampled as aux channels of the adc_stream)
+void joystick_feed_raw(int raw_x, int raw_y);
+
 // to read the current joystick position
 void joystick_read(joystick_pos_t *pos);
@@ -0,0 +1,188 @@
+#include "trigger.h"
+#include "capture.h"
+#include "host_test.h"
+#include <math.h>
+
+// edge trigger: fires on the first sample at / past the level after the signal went
+// through the hysteresis band, wherever the block boundaries fall. capture then places
+// that sample exactly pre-trigger samples into the record. also times trigger_scan
+// against checking one sample per call
+
+#define N           4000
+#define PERIOD      500
+#define FIRST_EDGE  250     // starts low, rising edges at FIRST_EDGE + k * PERIOD, falling half a period later
+#define LOW         1000
+#define HIGH        3000
+#define BENCH_N     (1 << 16)
+#define BENCH_REP   200
+
+static uint16_t sig[N];
+static uint16_t bench[BENCH_N];
+
+// every fire position in s, scanned in blocks of block samples
+static int fire_all(const uint16_t *s, size_t n, size_t block, int32_t *out, int max)
+{
+    int k = 0;
+    trigger_reset();
+    for (size_t base = 0; base < n; base += block) {
+        size_t len = n - base < block ? n - base : block;
+        size_t off = 0;
+        while (off < len && k < max) {
+            int32_t r = trigger_scan(s + base + off, len - off);
+            if (r < 0) { break;}
+            out[k++] = (int32_t)(base + off + r);
+            off += r + 1;
+        }
+    }
+    return k;
+}
+
+static void square(void)
+{
+    for (int i = 0; i < N; i++) {
+        int ph = (i - FIRST_EDGE + PERIOD) % PERIOD;
+        sig[i] = ph < PERIOD / 2 ? HIGH : LOW;
+    }
+}
+
+static void edges(void)
+{
+    trigger_config_t cfg = { .type = TRIGGER_TYPE_EDGE, .edge = TRIGGER_RISING, .level = 2048, .hysteresis = 40 };
+    int32_t hits[32];
+    square();
+
+    // same positions for any block size, including one sample at a time
+    size_t blocks[] = { 1, 7, 64, 256, N };
+    for (size_t b = 0; b < sizeof(blocks) / sizeof(blocks[0]); b++) {
+        trigger_configure(&cfg);
+        int k = fire_all(sig, N, blocks[b], hits, 32);
+        CHECK(k == N / PERIOD);
+        for (int i = 0; i < k; i++) { CHECK(hits[i] == FIRST_EDGE + i * PERIOD);}
+    }
+
+    cfg.edge = TRIGGER_FALLING;
+    trigger_configure(&cfg);
+    int k = fire_all(sig, N, 64, hits, 32);
+    CHECK(k == N / PERIOD - 1);
+    for (int i = 0; i < k; i++) { CHECK(hits[i] == FIRST_EDGE + PERIOD / 2 + i * PERIOD);}
+}
+
+static void hysteresis(void)
+{
+    trigger_config_t cfg = { .type = TRIGGER_TYPE_EDGE, .edge = TRIGGER_RISING, .level = 2048, .hysteresis = 40 };
+    trigger_configure(&cfg);
+    int32_t hits[8];
+    int n = 0;
+    // starts above the level: no edge until it has been below the band
+    for (int i = 0; i < 10; i++) { sig[n++] = 2100;}
+    for (int i = 0; i < 10; i++) { sig[n++] = 1000;}
+    sig[n++] = 2047;
+    sig[n++] = 2048;    // exactly on the level fires (20 + 1)
+    // chatter inside the band never re-arms
+    for (int i = 0; i < 20; i++) { sig[n++] = (i & 1) ? 2060 : 2009;}
+    sig[n++] = 2008;    // bottom of the band arms again
+    sig[n++] = 2100;    // and fires
+    int k = fire_all(sig, n, 5, hits, 8);
+    CHECK(k == 2);
+    CHECK(hits[0] == 21);
+    CHECK(hits[1] == n - 1);
+}
+
+// record of len with pre samples before the trigger, from the square wave fed in blocks
+static void pretrigger(uint32_t len, uint32_t pre)
+{
+    square();
+    trigger_config_t cfg = { .type = TRIGGER_TYPE_EDGE, .edge = TRIGGER_RISING, .level = 2048, .hysteresis = 40 };
+    trigger_configure(&cfg);
+    capture_set_mode(CAPTURE_MODE_NORMAL);
+    capture_set_record(len, pre);
+    capture_set_sample_rate(TIMER_RESOLUTION_HZ);    // one timer tick per sample: timestamp = sample index
+    capture_init();
+
+    const capture_frame_t *f = NULL;
+    for (uint32_t at = 0; at < N && !f; at += 256) {
+        uint32_t n = N - at < 256 ? N - at : 256;
+        capture_write_block(sig + at, n, at);
+        f = capture_take_frame();
+    }
+    CHECK(f != NULL);
+    if (!f) { return;}
+    uint64_t t = f->timestamp;
+    CHECK(f->view.len == len);
+    CHECK(f->trigger == pre);
+    CHECK(!f->forced);
+    // the trigger sample is a rising edge with a full pre-trigger history in front of it
+    CHECK(t >= pre && (t - FIRST_EDGE) % PERIOD == 0);
+    // the first edge that has enough history, nothing later
+    CHECK(t == FIRST_EDGE || t - PERIOD < pre);
+    // the record is the stream around it, sample for sample
+    for (uint32_t i = 0; i < len && t - pre + i < N; i++) {
+        if (capture_view_at(&f->view, i) != sig[t - pre + i]) {
+            CHECK(capture_view_at(&f->view, i) == sig[t - pre + i]);
+            break;
+        }
+    }
+}
+
+// the per-sample check a scan loop replaces: one call and both thresholds for every sample
+static bool naive_armed;
+static __attribute__((noinline)) bool naive_edge(uint16_t s, uint16_t arm, uint16_t fire)
+{
+    if (!naive_armed) {
+        naive_armed = s <= arm;
+        return false;
+    }
+    if (s < fire) { return false;}
+    naive_armed = false;
+    return true;
+}
+
+// fires over the bench signal in 256 sample blocks, both ways, and what each costs per sample
+static void speed(const char *name)
+{
+    trigger_config_t cfg = { .type = TRIGGER_TYPE_EDGE, .edge = TRIGGER_RISING, .level = 2048, .hysteresis = 40 };
+    trigger_configure(&cfg);
+    static int32_t hits[BENCH_N];
+    int k = 0;
+    double t = host_test_now();
+    for (int r = 0; r < BENCH_REP; r++) { k = fire_all(bench, BENCH_N, 256, hits, BENCH_N);}
+    double ts = host_test_now() - t;
+
+    int kn = 0;
+    t = host_test_now();
+    for (int r = 0; r < BENCH_REP; r++) {
+        naive_armed = false;
+        kn = 0;
+        for (int i = 0; i < BENCH_N; i++) { kn += naive_edge(bench[i], 2048 - 40, 2048);}
+    }
+    double tn = host_test_now() - t;
+    printf("%-12s %5d edges: trigger_scan %.2f ns/sample, per-sample check %.2f ns/sample\n", name, k,
+           ts * 1e9 / BENCH_N / BENCH_REP, tn * 1e9 / BENCH_N / BENCH_REP);
+    CHECK(k == kn);
+}
+
+// a clean square wave, and a noisy sine like a probe on a real signal (no recordings are
+// checked in): it goes through the hysteresis band on every cycle, and the noise chatters
+// around the level without firing again
+static void bench_signals(void)
+{
+    for (int i = 0; i < BENCH_N; i++) { bench[i] = ((i / 250) & 1) ? HIGH : LOW;}
+    speed("square");
+    uint32_t rng = 1;
+    for (int i = 0; i < BENCH_N; i++) {
+        rng = rng * 1664525u + 1013904223u;
+        bench[i] = lround(2048 + 1500 * sin(2 * M_PI * i / 333.3)) + (int)(rng >> 27) - 16;
+    }
+    speed("noisy sine");
+}
+
+int main(void)
+{
+    edges();
+    hysteresis();
+    uint32_t pres[] = { 0, 1, 100, 160, 299, 319 };
+    for (size_t i = 0; i < sizeof(pres) / sizeof(pres[0]); i++) { pretrigger(320, pres[i]);}
+    pretrigger(1200, 700);
+    bench_signals();
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,139 @@
+#include "trigger.h"
+#include "capture.h"
+#include "host_test.h"
+#include <math.h>
+
+// sub-sample trigger position: the crossing found by trigger_crossing_frac lies within
+// a couple of Q8 units (1/256 sample) of the true one, set by how coarse the codes are
+// on the edge. whole sample triggering would be off by up to TRIGGER_FRAC_ONE
+
+#define LEVEL   2048
+#define N       2048
+
+static uint16_t sig[N];
+static int32_t fired;   // trigger sample of the last crossing()
+
+static uint16_t code(double v)
+{
+    long c = lround(v);
+    return c < 0 ? 0 : c > 4095 ? 4095 : c;
+}
+
+// first fire over the whole buffer and the crossing estimate from it, in Q8 samples
+static double crossing(const uint16_t *s, size_t n)
+{
+    trigger_reset();
+    int32_t i = trigger_scan(s, n);
+    fired = i;
+    if (i < 1) { return -1;}
+    return i - trigger_crossing_frac(s[i - 1], s[i]) / (double)TRIGGER_FRAC_ONE;
+}
+
+static void edge(trigger_edge_t dir)
+{
+    trigger_config_t cfg = { .type = TRIGGER_TYPE_EDGE, .edge = dir, .level = LEVEL, .hysteresis = 40 };
+    trigger_configure(&cfg);
+    double slopes[] = { 20, 50, 200, 1000 };
+    for (int k = 0; k < 4; k++) {
+        double s = dir == TRIGGER_RISING ? slopes[k] : -slopes[k];
+        double worst = 0, whole = 0;
+        // true crossing at 100 + f / 256 for every fraction
+        for (int f = 0; f < TRIGGER_FRAC_ONE; f++) {
+            double t = 100 + f / (double)TRIGGER_FRAC_ONE;
+            for (int i = 0; i < 200; i++) { sig[i] = code(LEVEL + s * (i - t));}
+            double est = crossing(sig, 200);
+            double err = fabs(est - t) * TRIGGER_FRAC_ONE;
+            if (err > worst) { worst = err;}
+            double w = fabs(fired - t) * TRIGGER_FRAC_ONE;
+            if (w > whole) { whole = w;}
+        }
+        // half a code of rounding on the edge, plus the truncating divide
+        double bound = TRIGGER_FRAC_ONE / (2 * fabs(s)) + 1;
+        printf("%s %5.0f codes/sample: worst %.2f Q8 (bound %.2f), whole sample %.0f Q8\n",
+               dir == TRIGGER_RISING ? "rising " : "falling", fabs(s), worst, bound, whole);
+        CHECK(worst <= bound);
+        CHECK(whole > TRIGGER_FRAC_ONE * 3 / 4);
+    }
+}
+
+// the thresholds the other types cross interpolate too
+static void other_types(void)
+{
+    trigger_config_t w = { .type = TRIGGER_TYPE_WINDOW, .level_low = 1500, .level_high = 2500, .window_dir = TRIGGER_WINDOW_ENTER };
+    trigger_config_t sl = { .type = TRIGGER_TYPE_SLOPE, .edge = TRIGGER_RISING, .level_low = 1500, .level_high = 2500,
+                            .width_cond = TRIGGER_WIDTH_GREATER, .width_min = 1 };
+    for (int f = 0; f < TRIGGER_FRAC_ONE; f += 17) {
+        double t = 100 + f / (double)TRIGGER_FRAC_ONE;
+        // 100 codes a sample up through 1500 at t, so 2500 at t + 10
+        for (int i = 0; i < 200; i++) { sig[i] = code(1500 + 100 * (i - t));}
+        trigger_configure(&w);
+        CHECK_NEAR(crossing(sig, 200), t, 4.0 / TRIGGER_FRAC_ONE);
+        trigger_configure(&sl);
+        CHECK_NEAR(crossing(sig, 200), t + 10, 4.0 / TRIGGER_FRAC_ONE);
+    }
+}
+
+// hi-res samples carry 4 more bits, the estimate gets better not worse
+static void hires(void)
+{
+    trigger_config_t cfg = { .type = TRIGGER_TYPE_EDGE, .edge = TRIGGER_RISING, .level = LEVEL, .hysteresis = 40 };
+    trigger_configure(&cfg);
+    trigger_set_frac_bits(4);
+    double worst = 0;
+    for (int f = 0; f < TRIGGER_FRAC_ONE; f++) {
+        double t = 100 + f / (double)TRIGGER_FRAC_ONE;
+        for (int i = 0; i < 200; i++) { sig[i] = lround((LEVEL + 20 * (i - t)) * 16);}
+        double err = fabs(crossing(sig, 200) - t) * TRIGGER_FRAC_ONE;
+        if (err > worst) { worst = err;}
+    }
+    printf("hi-res     20 codes/sample: worst %.2f Q8\n", worst);
+    CHECK(worst <= TRIGGER_FRAC_ONE / (2 * 20.0 * 16) + 1);
+    trigger_set_frac_bits(0);
+}
+
+// through capture, on a sine, with the trigger landing on the first sample of a block:
+// the sample before it comes out of the record
+static void captured_sine(void)
+{
+    trigger_config_t cfg = { .type = TRIGGER_TYPE_EDGE, .edge = TRIGGER_RISING, .level = LEVEL, .hysteresis = 40 };
+    double period = 64.37;     // samples
+    double worst = 0;
+    int records = 0;
+    for (uint32_t block = 1; block <= 64; block++) {
+        // shifted a little every time, so each record sees a different fraction
+        double shift = block * 0.173;
+        for (int i = 0; i < N; i++) { sig[i] = code(LEVEL + 1500 * sin(2 * M_PI * (i + shift) / period));}
+        trigger_configure(&cfg);
+        capture_set_mode(CAPTURE_MODE_NORMAL);
+        capture_set_record(40, 20);
+        capture_set_sample_rate(TIMER_RESOLUTION_HZ);  // timestamp = sample index
+        capture_init();
+        const capture_frame_t *f = NULL;
+        for (uint32_t at = 0; at < N && !f; at += block) {
+            uint32_t n = N - at < block ? N - at : block;
+            capture_write_block(sig + at, n, at);
+            f = capture_take_frame();
+        }
+        CHECK(f != NULL);
+        if (!f) { continue;}
+        double est = f->timestamp - f->trigger_frac / (double)TRIGGER_FRAC_ONE;
+        double t = period * ceil((est - 1 + shift) / period) - shift;   // the upward zero crossing it found
+        double err = fabs(est - t) * TRIGGER_FRAC_ONE;
+        if (err > worst) { worst = err;}
+        records++;
+    }
+    printf("sine via capture, %d records: worst %.2f Q8\n", records, worst);
+    CHECK(records == 64);
+    // 146 codes / sample at the crossing, the ramp bound for that is 1.9 Q8
+    CHECK(worst <= 1.9);
+}
+
+int main(void)
+{
+    edge(TRIGGER_RISING);
+    edge(TRIGGER_FALLING);
+    other_types();
+    hires();
+    captured_sine();
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,259 @@
+#include "trigger.h"
+#include "host_test.h"
+#include <string.h>
+
+// pulse width, runt, window and slope triggers: each fires on the sample named in
+// trigger.h and only for events that meet the condition, for any block size. also times
+// each machine over a long pulse train
+
+#define N       4000
+#define MAX_HITS 16
+#define BENCH_N     (1 << 18)
+#define BENCH_REP   50
+
+static uint16_t sig[N];
+static uint16_t bench[BENCH_N];
+
+static void flat(uint16_t v)
+{
+    for (int i = 0; i < N; i++) { sig[i] = v;}
+}
+
+static void put(int at, int w, uint16_t v)
+{
+    for (int i = at; i < at + w; i++) { sig[i] = v;}
+}
+
+// linear ramp of w samples from a, in steps of step
+static void ramp(int at, int w, int a, int step)
+{
+    for (int i = 0; i < w; i++) { sig[at + i] = a + step * i;}
+}
+
+static int fire_all(size_t block, int32_t *out)
+{
+    int k = 0;
+    trigger_reset();
+    for (size_t base = 0; base < N; base += block) {
+        size_t len = N - base < block ? N - base : block;
+        size_t off = 0;
+        while (off < len && k < MAX_HITS) {
+            int32_t r = trigger_scan(sig + base + off, len - off);
+            if (r < 0) { break;}
+            out[k++] = (int32_t)(base + off + r);
+            off += r + 1;
+        }
+    }
+    return k;
+}
+
+// cfg fires exactly at want[0..n) over sig, scanned whole and in awkward block sizes
+static void expect(const trigger_config_t *cfg, const int32_t *want, int n, int line)
+{
+    size_t blocks[] = { 1, 13, 256, N };
+    for (size_t b = 0; b < sizeof(blocks) / sizeof(blocks[0]); b++) {
+        int32_t hits[MAX_HITS];
+        trigger_configure(cfg);
+        int k = fire_all(blocks[b], hits);
+        if (k != n || memcmp(hits, want, n * sizeof(hits[0])) != 0) {
+            printf("line %d, blocks of %zu: %d hits, want %d:", line, blocks[b], k, n);
+            for (int i = 0; i < k; i++) { printf(" %d", (int)hits[i]);}
+            printf("\n");
+            CHECK(0);
+        }
+    }
+}
+
+#define EXPECT(cfg, ...) do {                                                   \
+    int32_t want_[] = { __VA_ARGS__ };                                          \
+    expect(&(cfg), want_, (int)(sizeof(want_) / sizeof(want_[0])) - 1, __LINE__); \
+} while (0)
+// EXPECT lists end in a -1 sentinel so an empty list still compiles
+#define END -1
+
+static void pulse_width(void)
+{
+    // positive pulses of 5, 9, 10, 20, 30, 31 and 50 samples, the first already high at the start
+    flat(1000);
+    put(0, 40, 3000);
+    put(300, 5, 3000);
+    put(600, 9, 3000);
+    put(900, 10, 3000);
+    put(1200, 20, 3000);
+    put(1500, 30, 3000);
+    put(1800, 31, 3000);
+    put(2100, 50, 3000);
+    trigger_config_t c = { .type = TRIGGER_TYPE_PULSE_WIDTH, .edge = TRIGGER_RISING, .level = 2000, .hysteresis = 50 };
+
+    // fires on the sample that ends the pulse. the one in progress at the start has no known width
+    c.width_cond = TRIGGER_WIDTH_LESS;
+    c.width_min = 10;
+    EXPECT(c, 305, 609, END);
+    c.width_cond = TRIGGER_WIDTH_GREATER;
+    c.width_min = 30;
+    EXPECT(c, 1831, 2150, END);
+    c.width_cond = TRIGGER_WIDTH_IN_RANGE;
+    c.width_min = 10;
+    c.width_max = 30;
+    EXPECT(c, 910, 1220, 1530, END);
+
+    // negative pulses, same widths
+    flat(3000);
+    put(700, 20, 1000);
+    put(1700, 50, 1000);
+    c.edge = TRIGGER_FALLING;
+    EXPECT(c, 720, END);
+
+    // the band is the hysteresis: dipping to level - hysteresis + 1 does not end a pulse
+    flat(1000);
+    put(500, 10, 3000);
+    put(510, 1, 1951);
+    put(511, 10, 3000);
+    c.edge = TRIGGER_RISING;
+    c.width_cond = TRIGGER_WIDTH_GREATER;
+    c.width_min = 15;
+    EXPECT(c, 521, END);
+}
+
+static void runt(void)
+{
+    // full height pulse, then a runt that only gets between the thresholds
+    flat(1000);
+    put(500, 20, 3000);
+    put(1500, 20, 2000);
+    put(2500, 20, 2499);
+    trigger_config_t c = { .type = TRIGGER_TYPE_RUNT, .edge = TRIGGER_RISING, .level_low = 1500, .level_high = 2500 };
+    // fires when it turns back below level_low
+    EXPECT(c, 1520, 2520, END);
+
+    // negative runts dip below level_high but not level_low, fire on the way back up through it
+    flat(3000);
+    put(300, 10, 1000);
+    put(800, 10, 2000);
+    c.edge = TRIGGER_FALLING;
+    EXPECT(c, 810, END);
+}
+
+static void window(void)
+{
+    // in and out of [1500, 2500], then straight across it, then touching the edges
+    flat(1000);
+    put(800, 100, 2000);
+    put(2000, 100, 3000);
+    put(3000, 1, 1500);
+    put(3500, 1, 2501);
+    trigger_config_t c = { .type = TRIGGER_TYPE_WINDOW, .level_low = 1500, .level_high = 2500 };
+    c.window_dir = TRIGGER_WINDOW_ENTER;
+    EXPECT(c, 800, 3000, END);
+    c.window_dir = TRIGGER_WINDOW_EXIT;
+    EXPECT(c, 900, 3001, END);
+}
+
+static void slope(void)
+{
+    // 1200 -> 2800 in 9 samples (200 / sample) and in 33 (50 / sample), then one that turns back
+    flat(1000);
+    ramp(500, 10, 1000, 200);
+    put(510, 100, 3000);
+    ramp(1500, 40, 1000, 50);
+    put(1540, 100, 3000);
+    ramp(2500, 10, 1000, 100);
+    trigger_config_t c = { .type = TRIGGER_TYPE_SLOPE, .edge = TRIGGER_RISING, .level_low = 1200, .level_high = 2800 };
+    // fires on reaching the far threshold
+    c.width_cond = TRIGGER_WIDTH_GREATER;
+    c.width_min = 20;
+    EXPECT(c, 1536, END);
+    c.width_cond = TRIGGER_WIDTH_LESS;
+    EXPECT(c, 509, END);
+    c.width_cond = TRIGGER_WIDTH_IN_RANGE;
+    c.width_min = 9;
+    c.width_max = 33;
+    EXPECT(c, 509, 1536, END);
+
+    // a step across both thresholds in one sample is a slope of 1
+    flat(1000);
+    put(700, 10, 3000);
+    c.width_cond = TRIGGER_WIDTH_LESS;
+    c.width_min = 2;
+    EXPECT(c, 700, END);
+
+    // falling slopes: 2800 -> 1200
+    flat(3000);
+    ramp(600, 10, 3000, -200);
+    put(610, 100, 1000);
+    c.edge = TRIGGER_FALLING;
+    c.width_min = 20;
+    EXPECT(c, 609, END);
+}
+
+// noisy pulses of random width, edge time and height (about a third are runts that stop
+// between the thresholds), so every machine keeps changing state
+static void pulse_train(void)
+{
+    uint32_t rng = 1;
+#define RAND(n) (rng = rng * 1664525u + 1013904223u, (int)((rng >> 8) % (n)))
+    int i = 0;
+    while (i < BENCH_N) {
+        int low = 20 + RAND(200), edge = 1 + RAND(40), high = 5 + RAND(200);
+        int top = RAND(3) ? 3000 : 2000;
+        int seg[] = { low, edge, high, edge };
+        for (int p = 0; p < 4; p++) {
+            for (int j = 0; j < seg[p] && i < BENCH_N; j++, i++) {
+                int v = (p == 0) ? 1000 : (p == 2) ? top :
+                        (p == 1) ? 1000 + (top - 1000) * j / edge : top - (top - 1000) * j / edge;
+                bench[i] = v + RAND(33) - 16;
+            }
+        }
+    }
+#undef RAND
+}
+
+static void speed_one(const char *name, const trigger_config_t *cfg)
+{
+    trigger_configure(cfg);
+    int k = 0;
+    double t = host_test_now();
+    for (int r = 0; r < BENCH_REP; r++) {
+        trigger_reset();
+        k = 0;
+        for (size_t base = 0; base < BENCH_N; base += 256) {
+            size_t off = 0;
+            int32_t at;
+            while (off < 256 && (at = trigger_scan(bench + base + off, 256 - off)) >= 0) {
+                k++;
+                off += at + 1;
+            }
+        }
+    }
+    double dt = host_test_now() - t;
+    printf("%-12s %5d fires, %.2f ns/sample\n", name, k, dt * 1e9 / BENCH_N / BENCH_REP);
+    CHECK(k > 0);
+}
+
+static void speed(void)
+{
+    pulse_train();
+    trigger_config_t edge = { .type = TRIGGER_TYPE_EDGE, .edge = TRIGGER_RISING, .level = 2000, .hysteresis = 50 };
+    trigger_config_t width = { .type = TRIGGER_TYPE_PULSE_WIDTH, .edge = TRIGGER_RISING, .level = 2000, .hysteresis = 50,
+                               .width_cond = TRIGGER_WIDTH_IN_RANGE, .width_min = 50, .width_max = 100 };
+    trigger_config_t runt = { .type = TRIGGER_TYPE_RUNT, .edge = TRIGGER_RISING, .level_low = 1500, .level_high = 2500 };
+    trigger_config_t window = { .type = TRIGGER_TYPE_WINDOW, .level_low = 1500, .level_high = 2500,
+                                .window_dir = TRIGGER_WINDOW_EXIT };
+    trigger_config_t slope = { .type = TRIGGER_TYPE_SLOPE, .edge = TRIGGER_RISING, .level_low = 1200, .level_high = 1800,
+                               .width_cond = TRIGGER_WIDTH_GREATER, .width_min = 8 };
+    speed_one("edge", &edge);
+    speed_one("pulse width", &width);
+    speed_one("runt", &runt);
+    speed_one("window", &window);
+    speed_one("slope", &slope);
+}
+
+int main(void)
+{
+    pulse_width();
+    runt();
+    window();
+    slope();
+    speed();
+    return HOST_TEST_RESULT();
+}
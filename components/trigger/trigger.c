@@ -0,0 +1,294 @@
+#include "trigger.h"
+#include <stdbool.h>
+
+static trigger_config_t config = {
+    .type = TRIGGER_TYPE_EDGE,
+    .edge = TRIGGER_RISING,
+    .level = 2048,
+    .hysteresis = 32,
+};
+
+// precomputed thresholds so the scan loops are a single compare per sample
+static uint16_t arm_level = 2048 - 32;  // rising: must dip to <= this first, falling: >= this
+static uint16_t fire_level = 2048;      // rising: fires at >= this, falling: <= this
+static bool armed = false;
+
+// the other types are written for positive going events only. for falling ones every
+// sample and threshold is xor'ed with 0xFFFF, which flips the ordering of the codes
+static uint16_t flip;
+static uint16_t lo;             // lower threshold after flipping
+static uint16_t hi;             // upper threshold after flipping
+static int frac_bits = 0;       // extra bits below the 12 bit code the samples carry (hi-res)
+static uint32_t code_scale = 1u << 16;  // Q16, sample code -> config code (input range)
+
+// state shared by the non edge machines
+typedef enum {
+    ST_IDLE,        // nothing seen yet, or waiting to get back below lo
+    ST_LOW,         // below the start threshold, ready for an event
+    ST_ACTIVE,      // event in progress (pulse high / runt above lo / slope between lo and hi)
+    ST_DONE,        // event finished (runt: reached hi so it is not a runt), wait for lo again
+} adv_state_t;
+
+static adv_state_t adv_state = ST_IDLE;
+static uint32_t duration;       // samples spent in ST_ACTIVE so far
+static int8_t inside = -1;      // window: -1 unknown, else whether the last sample was inside
+
+// config levels are 12 bit codes, the thresholds are in the samples' own scale and range
+static uint16_t scaled(int code)
+{
+    int v = (int)(((int64_t)code << 16) / code_scale) << frac_bits;
+    if (v < 0) { v = 0;}
+    if (v > UINT16_MAX) { v = UINT16_MAX;}
+    return v;
+}
+
+static void apply_thresholds(void)
+{
+    const trigger_config_t *cfg = &config;
+    int band_lo = (int)cfg->level - cfg->hysteresis;
+    int band_hi = (int)cfg->level + cfg->hysteresis;
+
+    fire_level = scaled(cfg->level);
+    arm_level = scaled((cfg->edge == TRIGGER_RISING) ? band_lo : band_hi);
+
+    // flipped thresholds for the other types. pulse width reuses level / hysteresis
+    flip = (cfg->edge == TRIGGER_RISING) ? 0 : 0xFFFF;
+    if (cfg->type == TRIGGER_TYPE_PULSE_WIDTH) {
+        lo = arm_level ^ flip;
+        hi = fire_level ^ flip;
+    } else if (cfg->edge == TRIGGER_RISING) {
+        lo = scaled(cfg->level_low);
+        hi = scaled(cfg->level_high);
+    } else {
+        lo = scaled(cfg->level_high) ^ flip;
+        hi = scaled(cfg->level_low) ^ flip;
+    }
+}
+
+void trigger_configure(const trigger_config_t *cfg)
+{
+    config = *cfg;
+    apply_thresholds();
+    trigger_reset();
+}
+
+void trigger_set_frac_bits(int bits)
+{
+    frac_bits = bits;
+    apply_thresholds();
+    trigger_reset();
+}
+
+void trigger_set_code_scale(uint32_t scale)
+{
+    code_scale = scale ? scale : 1u << 16;
+    apply_thresholds();
+    trigger_reset();
+}
+
+const trigger_config_t *trigger_get_config(void)
+{
+    return &config;
+}
+
+void trigger_reset(void)
+{
+    armed = false;
+    adv_state = ST_IDLE;
+    duration = 0;
+    inside = -1;
+}
+
+static bool width_ok(uint32_t d)
+{
+    switch (config.width_cond) {
+    case TRIGGER_WIDTH_LESS:    return d < config.width_min;
+    case TRIGGER_WIDTH_GREATER: return d > config.width_min;
+    default:                    return d >= config.width_min && d <= config.width_max;
+    }
+}
+
+static int32_t scan_rising(const uint16_t *s, size_t n)
+{
+    size_t i = 0;
+    while (i < n) {
+        if (!armed) {
+            // wait for the signal to get below the hysteresis band
+            while (i < n && s[i] > arm_level) { i++;}
+            if (i == n) { break;}
+            armed = true;
+        }
+        // then for it to come back up through the level
+        while (i < n && s[i] < fire_level) { i++;}
+        if (i == n) { break;}
+        armed = false;
+        return (int32_t)i;
+    }
+    return -1;
+}
+
+static int32_t scan_falling(const uint16_t *s, size_t n)
+{
+    size_t i = 0;
+    while (i < n) {
+        if (!armed) {
+            while (i < n && s[i] < arm_level) { i++;}
+            if (i == n) { break;}
+            armed = true;
+        }
+        while (i < n && s[i] > fire_level) { i++;}
+        if (i == n) { break;}
+        armed = false;
+        return (int32_t)i;
+    }
+    return -1;
+}
+
+// positive pulse: high once >= hi (level), low again at <= lo (level - hysteresis).
+// fires on the falling crossing that ends a pulse of the right width
+static int32_t scan_pulse_width(const uint16_t *s, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        uint16_t v = s[i] ^ flip;
+        switch (adv_state) {
+        case ST_IDLE:
+        case ST_DONE:
+            // a pulse already in progress when we armed has an unknown width, skip it
+            if (v <= lo) { adv_state = ST_LOW;}
+            break;
+        case ST_LOW:
+            if (v >= hi) {
+                adv_state = ST_ACTIVE;
+                duration = 1;
+            }
+            break;
+        case ST_ACTIVE:
+            if (v > lo) {
+                duration++;
+                // nothing can save a pulse that is already too long for "<" or the range
+                if (config.width_cond != TRIGGER_WIDTH_GREATER && !width_ok(duration) &&
+                    duration > config.width_min) {
+                    adv_state = ST_IDLE;
+                }
+                break;
+            }
+            adv_state = ST_LOW;
+            if (width_ok(duration)) { return (int32_t)i;}
+            break;
+        }
+    }
+    return -1;
+}
+
+// positive runt: climbs through lo, turns back below lo without ever reaching hi
+static int32_t scan_runt(const uint16_t *s, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        uint16_t v = s[i] ^ flip;
+        switch (adv_state) {
+        case ST_IDLE:
+            if (v < lo) { adv_state = ST_LOW;}
+            break;
+        case ST_LOW:
+            if (v >= lo) { adv_state = (v >= hi) ? ST_DONE : ST_ACTIVE;}
+            break;
+        case ST_ACTIVE:
+            if (v >= hi) {
+                adv_state = ST_DONE; // full height pulse
+            } else if (v < lo) {
+                adv_state = ST_LOW;
+                return (int32_t)i;
+            }
+            break;
+        case ST_DONE:
+            if (v < lo) { adv_state = ST_LOW;}
+            break;
+        }
+    }
+    return -1;
+}
+
+// window: inside means lo <= v <= hi. fires on the sample that makes the requested transition
+static int32_t scan_window(const uint16_t *s, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        uint16_t v = s[i] ^ flip;
+        int8_t now = (v >= lo && v <= hi);
+        int8_t was = inside;
+        inside = now;
+        if (was < 0 || was == now) { continue;}
+        if (now == (config.window_dir == TRIGGER_WINDOW_ENTER)) { return (int32_t)i;}
+    }
+    return -1;
+}
+
+// rising slope: time from leaving lo upwards to reaching hi. falling back below lo aborts
+static int32_t scan_slope(const uint16_t *s, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        uint16_t v = s[i] ^ flip;
+        switch (adv_state) {
+        case ST_IDLE:
+        case ST_DONE:
+            if (v < lo) { adv_state = ST_LOW;}
+            break;
+        case ST_LOW:
+            if (v >= hi) {
+                // whole transition inside one sample period
+                adv_state = ST_DONE;
+                if (width_ok(1)) { return (int32_t)i;}
+            } else if (v >= lo) {
+                adv_state = ST_ACTIVE;
+                duration = 1;
+            }
+            break;
+        case ST_ACTIVE:
+            if (v < lo) {
+                adv_state = ST_LOW;
+            } else if (v >= hi) {
+                adv_state = ST_DONE;
+                if (width_ok(duration + 1)) { return (int32_t)i;}
+            } else {
+                duration++;
+            }
+            break;
+        }
+    }
+    return -1;
+}
+
+uint16_t trigger_crossing_frac(uint16_t before, uint16_t at)
+{
+    // which threshold the firing sample went through, in the flipped (positive going) domain
+    int32_t b = before ^ flip;
+    int32_t a = at ^ flip;
+    int32_t t;
+    switch (config.type) {
+    case TRIGGER_TYPE_EDGE:        t = fire_level ^ flip; break;
+    case TRIGGER_TYPE_SLOPE:       t = hi; break;
+    case TRIGGER_TYPE_WINDOW:      t = ((a < lo) != (b < lo)) ? lo : hi; break;
+    default:                       t = lo; break; // pulse width, runt: end of the pulse
+    }
+
+    // one divide per trigger, never per sample
+    int32_t span = (a > b) ? a - b : b - a;
+    int32_t dist = (a > t) ? a - t : t - a;
+    if (span == 0 || dist >= span) { return 0;} // flat or not bracketed (noise), no better guess
+    return (uint16_t)(((uint32_t)dist << TRIGGER_FRAC_BITS) / span);
+}
+
+int32_t trigger_scan(const uint16_t *samples, size_t n)
+{
+    switch (config.type) {
+    case TRIGGER_TYPE_PULSE_WIDTH: return scan_pulse_width(samples, n);
+    case TRIGGER_TYPE_RUNT:        return scan_runt(samples, n);
+    case TRIGGER_TYPE_WINDOW:      return scan_window(samples, n);
+    case TRIGGER_TYPE_SLOPE:       return scan_slope(samples, n);
+    default:
+        break;
+    }
+    if (config.edge == TRIGGER_RISING) {
+        return scan_rising(samples, n);
+    }
+    return scan_falling(samples, n);
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Trigger engine. scans sample blocks as they arrive and reports the sample that
+// qualifies the trigger. every type is a small streaming state machine: state
+// carries across blocks, each sample is looked at once and costs a compare or two,
+// nothing is ever re-scanned.
+//
+// works on raw ADC codes: "rising" / "positive" means the code goes up. the scope
+// front end inverts (low codes are positive volts, see ADC_LUT_MV) so a rising voltage
+// edge is TRIGGER_FALLING here.
+
+typedef enum {
+    TRIGGER_TYPE_EDGE,          // crossing level (with hysteresis)
+    TRIGGER_TYPE_PULSE_WIDTH,   // pulse across level whose width meets width_cond. fires at the pulse end
+    TRIGGER_TYPE_RUNT,          // pulse that crosses level_low but turns back before level_high. fires when it turns back
+    TRIGGER_TYPE_WINDOW,        // signal enters / leaves [level_low, level_high]. fires on the crossing
+    TRIGGER_TYPE_SLOPE,         // transition level_low -> level_high whose duration meets width_cond. fires at the far threshold
+} trigger_type_t;
+
+typedef enum {
+    TRIGGER_RISING,             // edge / slope direction, or positive pulses for pulse width / runt
+    TRIGGER_FALLING,
+} trigger_edge_t;
+
+typedef enum {
+    TRIGGER_WIDTH_LESS,         // duration < width_min
+    TRIGGER_WIDTH_GREATER,      // duration > width_min
+    TRIGGER_WIDTH_IN_RANGE,     // width_min <= duration <= width_max
+} trigger_width_cond_t;
+
+typedef enum {
+    TRIGGER_WINDOW_ENTER,
+    TRIGGER_WINDOW_EXIT,
+} trigger_window_dir_t;
+
+typedef struct {
+    trigger_type_t type;
+    trigger_edge_t edge;
+    uint16_t level;             // edge, pulse width: raw code to cross
+    uint16_t hysteresis;        // edge, pulse width: noise band below (rising) / above (falling) level
+    uint16_t level_low;         // runt, window, slope: lower threshold
+    uint16_t level_high;        // runt, window, slope: upper threshold
+    trigger_width_cond_t width_cond;    // pulse width, slope
+    uint32_t width_min;         // samples
+    uint32_t width_max;         // samples, only for TRIGGER_WIDTH_IN_RANGE
+    trigger_window_dir_t window_dir;
+} trigger_config_t;
+
+// sets the trigger up and disarms
+void trigger_configure(const trigger_config_t *cfg);
+
+// current configuration
+const trigger_config_t *trigger_get_config(void);
+
+// samples carry this many extra bits below the 12 bit code (hi-res). levels in the
+// config stay 12 bit codes and are scaled to match. disarms
+void trigger_set_frac_bits(int bits);
+
+// samples come from an input range whose codes are scale / 65536 of the codes the
+// config levels are given in, so a level stays the same voltage across ranges. disarms
+void trigger_set_code_scale(uint32_t scale);
+
+// forget any half seen event (call when a new record is armed)
+void trigger_reset(void);
+
+// scans n samples, returns the index of the trigger sample or -1 if none in this block
+int32_t trigger_scan(const uint16_t *samples, size_t n);
+
+// fixed point fraction bits of trigger_crossing_frac
+#define TRIGGER_FRAC_BITS   8
+#define TRIGGER_FRAC_ONE    (1 << TRIGGER_FRAC_BITS)
+
+// where between the sample before the trigger sample and the trigger sample itself the
+// threshold was actually crossed, by linear interpolation. returned as how far back
+// from the trigger sample it lies, in 1/TRIGGER_FRAC_ONE samples: 0 = on the trigger sample
+uint16_t trigger_crossing_frac(uint16_t before, uint16_t at);
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// minimal checks for the host tests: every failed check is printed with its
+// location, the test keeps going and main returns HOST_TEST_RESULT()
+
+static int host_test_failures;
+
+#define CHECK(cond) do {                                                        \
+    if (!(cond)) {                                                              \
+        printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond);         \
+        host_test_failures++;                                                   \
+    }                                                                           \
+} while (0)
+
+// a and b within tol of each other, all three converted to double
+#define CHECK_NEAR(a, b, tol) do {                                              \
+    double a_ = (a), b_ = (b);                                                  \
+    if (!(a_ - b_ <= (tol) && b_ - a_ <= (tol))) {                              \
+        printf("%s:%d: %s = %g, expected %s = %g +/- %g\n", __FILE__, __LINE__, \
+               #a, a_, #b, b_, (double)(tol));                                  \
+        host_test_failures++;                                                   \
+    }                                                                           \
+} while (0)
+
+#define HOST_TEST_RESULT() (host_test_failures ? (printf("%d check(s) failed\n", host_test_failures), EXIT_FAILURE) \
+                                               : (printf("ok\n"), EXIT_SUCCESS))
+
+// monotonic seconds, for the timed loops
+static inline double host_test_now(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
@@ -0,0 +1,225 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+struct shim_task {
+    pthread_t thread;
+    TaskFunction_t fn;
+    void *arg;
+    pthread_mutex_t lock;
+    pthread_cond_t notified;
+    uint32_t notify_count;
+};
+
+struct shim_queue {
+    pthread_mutex_t lock;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+    uint8_t *items;
+    UBaseType_t length;
+    UBaseType_t item_size;
+    UBaseType_t head;
+    UBaseType_t count;
+};
+
+static __thread struct shim_task *current_task;
+static struct timespec boot;
+static pthread_once_t boot_once = PTHREAD_ONCE_INIT;
+
+static void boot_init(void)
+{
+    clock_gettime(CLOCK_MONOTONIC, &boot);
+}
+
+// absolute CLOCK_MONOTONIC deadline ticks from now
+static struct timespec deadline_after(TickType_t ticks)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    uint64_t ns = (uint64_t)ticks * portTICK_PERIOD_MS * 1000000ull + t.tv_nsec;
+    t.tv_sec += ns / 1000000000ull;
+    t.tv_nsec = ns % 1000000000ull;
+    return t;
+}
+
+// waits on cond until pred holds, the deadline passes (false) or forever with portMAX_DELAY
+#define WAIT_UNTIL(cond, lock, pred, ticks) ({                                          \
+    bool ok_ = true;                                                                    \
+    struct timespec dl_ = deadline_after((ticks) == portMAX_DELAY ? 0 : (ticks));       \
+    while (!(pred)) {                                                                   \
+        if ((ticks) == 0) { ok_ = false; break;}                                        \
+        if ((ticks) == portMAX_DELAY) { pthread_cond_wait(cond, lock); continue;}       \
+        if (pthread_cond_timedwait(cond, lock, &dl_) == ETIMEDOUT && !(pred)) { ok_ = false; break;} \
+    }                                                                                   \
+    ok_; })
+
+static void condattr_monotonic(pthread_cond_t *cond)
+{
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(cond, &attr);
+    pthread_condattr_destroy(&attr);
+}
+
+static struct shim_task *task_new(void)
+{
+    struct shim_task *t = calloc(1, sizeof(*t));
+    pthread_mutex_init(&t->lock, NULL);
+    condattr_monotonic(&t->notified);
+    return t;
+}
+
+static void *task_entry(void *arg)
+{
+    struct shim_task *t = arg;
+    current_task = t;
+    t->fn(t->arg);
+    return NULL;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *arg,
+                       UBaseType_t prio, TaskHandle_t *handle)
+{
+    (void)name;
+    (void)stack;
+    (void)prio;
+    pthread_once(&boot_once, boot_init);
+    struct shim_task *t = task_new();
+    t->fn = fn;
+    t->arg = arg;
+    if (handle) { *handle = t;}
+    if (pthread_create(&t->thread, NULL, task_entry, t) != 0) { return pdFAIL;}
+    pthread_detach(t->thread);
+    return pdPASS;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack, void *arg,
+                                   UBaseType_t prio, TaskHandle_t *handle, BaseType_t core)
+{
+    (void)core; // the host scheduler places threads itself
+    return xTaskCreate(fn, name, stack, arg, prio, handle);
+}
+
+// the main thread becomes a task the first time it asks for its handle
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    if (!current_task) { current_task = task_new();}
+    return current_task;
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    struct timespec t = { ticks * portTICK_PERIOD_MS / 1000, (ticks * portTICK_PERIOD_MS % 1000) * 1000000L };
+    while (nanosleep(&t, &t) != 0 && errno == EINTR) {}
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    pthread_once(&boot_once, boot_init);
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    int64_t ms = (t.tv_sec - boot.tv_sec) * 1000 + (t.tv_nsec - boot.tv_nsec) / 1000000;
+    return (TickType_t)(ms / portTICK_PERIOD_MS);
+}
+
+void shim_task_yield(void)
+{
+    sched_yield();
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    pthread_mutex_lock(&task->lock);
+    task->notify_count++;
+    pthread_cond_signal(&task->notified);
+    pthread_mutex_unlock(&task->lock);
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *woken)
+{
+    xTaskNotifyGive(task);
+    if (woken) { *woken = pdTRUE;}
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks)
+{
+    struct shim_task *t = xTaskGetCurrentTaskHandle();
+    pthread_mutex_lock(&t->lock);
+    WAIT_UNTIL(&t->notified, &t->lock, t->notify_count > 0, ticks);
+    uint32_t n = t->notify_count;
+    if (n > 0) { t->notify_count = clear ? 0 : n - 1;}
+    pthread_mutex_unlock(&t->lock);
+    return n;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size)
+{
+    struct shim_queue *q = calloc(1, sizeof(*q));
+    q->items = malloc((size_t)length * item_size);
+    q->length = length;
+    q->item_size = item_size;
+    pthread_mutex_init(&q->lock, NULL);
+    condattr_monotonic(&q->not_empty);
+    condattr_monotonic(&q->not_full);
+    return q;
+}
+
+void vQueueDelete(QueueHandle_t q)
+{
+    pthread_mutex_destroy(&q->lock);
+    pthread_cond_destroy(&q->not_empty);
+    pthread_cond_destroy(&q->not_full);
+    free(q->items);
+    free(q);
+}
+
+BaseType_t xQueueSend(QueueHandle_t q, const void *item, TickType_t ticks)
+{
+    pthread_mutex_lock(&q->lock);
+    bool ok = WAIT_UNTIL(&q->not_full, &q->lock, q->count < q->length, ticks);
+    if (ok) {
+        UBaseType_t at = (q->head + q->count) % q->length;
+        memcpy(q->items + (size_t)at * q->item_size, item, q->item_size);
+        q->count++;
+        pthread_cond_signal(&q->not_empty);
+    }
+    pthread_mutex_unlock(&q->lock);
+    return ok ? pdPASS : errQUEUE_FULL;
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t q, const void *item, BaseType_t *woken)
+{
+    BaseType_t r = xQueueSend(q, item, 0);
+    if (woken) { *woken = r == pdPASS;}
+    return r;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t ticks)
+{
+    pthread_mutex_lock(&q->lock);
+    bool ok = WAIT_UNTIL(&q->not_empty, &q->lock, q->count > 0, ticks);
+    if (ok) {
+        memcpy(item, q->items + (size_t)q->head * q->item_size, q->item_size);
+        q->head = (q->head + 1) % q->length;
+        q->count--;
+        pthread_cond_signal(&q->not_full);
+    }
+    pthread_mutex_unlock(&q->lock);
+    return ok ? pdPASS : pdFAIL;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q)
+{
+    pthread_mutex_lock(&q->lock);
+    UBaseType_t n = q->count;
+    pthread_mutex_unlock(&q->lock);
+    return n;
+}
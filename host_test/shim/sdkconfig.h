@@ -0,0 +1,7 @@
+#pragma once
+
+// the host build is the linux target
+
+#define CONFIG_IDF_TARGET_LINUX     1
+#define CONFIG_IDF_TARGET           "linux"
+#define CONFIG_FREERTOS_HZ          1000
@@ -1,13 +1,13 @@
 #include <stdio.h>
+#include <stdatomic.h>
+#include <math.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
-#include "freertos/queue.h"
 
-#include "esp_adc/adc_oneshot.h"
-#include "driver/gptimer.h"
 #include "esp_log.h"
-#include "esp_wifi.h" //need to ensure wifi is off to use ADC on GPIO2
+#include "esp_wifi.h" // wifi off for adc_logger, which still reads GPIO2 on ADC2
 #include "esp_timer.h"
+#include "esp_app_desc.h"
 #include "driver/gpio.h"
 
 #include "LUT.h"
@@ -16,19 +16,34 @@
 #include "waveform_display.h"
 #include "joystick_dma.h"
 #include "btns.h"
+#include "adc_stream.h"
+#include "block_ring.h"
+#include "capture.h"
+#include "trigger.h"
+#include "decimate.h"
 
 static const char *TAG = "lab7";
 
 // global stuff
-QueueHandle_t adc_queue;
-volatile uint16_t adc_buff[ADC_BUFFER_SIZE];
-volatile size_t adc_index = 0;
-adc_oneshot_unit_handle_t adc_handle;
-gptimer_handle_t gptimer;
+static block_ring_t adc_ring;
+TaskHandle_t adc_task_handle = NULL;
 TaskHandle_t main_task_handle = NULL;
 TimerHandle_t frame_timer;
 uint8_t frame_count = 0;
 joystick_pos_t joystick_pos;
+static bool hires_on = false;
+static bool peak_on = false;
+
+// sampling chain: stream rate, log2 of the decimation factor behind it and whether that
+// goes through the anti-alias filter or the peak detect min / max, packed into one word
+// so the sample task always sees a matching set
+#define CHAIN(rate, shift, aa, peak) ((rate) << 6 | (peak) << 5 | (aa) << 4 | (shift))
+#define CHAIN_RATE(c)           ((c) >> 6)
+#define CHAIN_PEAK(c)           (((c) >> 5) & 1)
+#define CHAIN_AA(c)             (((c) >> 4) & 1)
+#define CHAIN_SHIFT(c)          ((c) & 0xf)
+static atomic_uint chain_req;
+static atomic_uint lost_blocks;     // block numbers the sample task never saw
 
 
 static void frame_timer_cb(TimerHandle_t xTimer) 
@@ -40,32 +55,359 @@ static void frame_timer_cb(TimerHandle_t xTimer)
     }
 }
 
-// ADC Timer ISR
-IRAM_ATTR static bool timer_callback(gptimer_handle_t timer,
-                                     const gptimer_alarm_event_data_t *edata,
-                                     void *user_ctx)
+// ADC stream block callback (runs in the stream task, DMA did the sampling)
+static void adc_block_cb(const adc_block_t *block, void *ctx)
 {
-    uint16_t sample = 0;
-    adc_oneshot_read(adc_handle, ADC_CHANNEL, (int*) &sample);
-    BaseType_t hp = pdFALSE;
-    xQueueSendFromISR(adc_queue, &sample, &hp);
-    return (hp == pdTRUE);
+    // one copy + one notify per block. a full ring is counted as an overrun and the block dropped
+    if (block_ring_push(&adc_ring, block)) {
+        xTaskNotifyGive(adc_task_handle);
+    }
+    joystick_feed_raw(adc_stream_get_aux(0), adc_stream_get_aux(1));
 }
 
-// ADC Queue Consumer → Store in Circular Buffer
+// ADC Ring Consumer → capture store, a whole block per wakeup. when the stream runs
+// faster than the display rate (hi-res, slow timebases) the blocks are boxcar averaged,
+// anti-alias filtered or, in peak detect, reduced to min / max pairs down to it on the way
 void adc_sample_task(void *arg)
 {
-    uint16_t val;
+    static decimate_boxcar_t boxcar[ADC_STREAM_NUM_CHANNELS];
+    static decimate_cic_t cic[ADC_STREAM_NUM_CHANNELS];
+    static decimate_peak_t peak[ADC_STREAM_NUM_CHANNELS];
+    static uint16_t dec[ADC_STREAM_NUM_CHANNELS][ADC_STREAM_BLOCK_SAMPLES];
+    const uint16_t *lanes[ADC_STREAM_NUM_CHANNELS];
+    uint32_t chain = 0;
+    int range = -1;
+    uint32_t next_seq = 0;
+    bool have_seq = false;
+    decimate_boxcar_init(&boxcar[0], 1);
+
     while (1)
     {
-        if (xQueueReceive(adc_queue, &val, portMAX_DELAY))
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        const adc_block_t *block;
+        while ((block = block_ring_peek(&adc_ring)) != NULL)
         {
-            adc_buff[adc_index] = val;
-            adc_index = (adc_index + 1) % ADC_BUFFER_SIZE;
+            // a jump in the block numbers is a ring overrun or a driver overflow upstream
+            if (have_seq && block->seq != next_seq) {
+                atomic_fetch_add_explicit(&lost_blocks, block->seq - next_seq, memory_order_relaxed);
+                capture_mark_gap();
+            }
+            next_seq = block->seq + 1;
+            have_seq = true;
+
+            // switch the whole chain over on the first block at the new stream rate, so
+            // no record mixes two rates. a boxcar only change applies on the next block
+            uint32_t req = atomic_load_explicit(&chain_req, memory_order_acquire);
+            if (req != chain && block->rate_hz == CHAIN_RATE(req)) {
+                chain = req;
+                for (int c = 0; c < ADC_STREAM_NUM_CHANNELS; c++) {
+                    decimate_boxcar_init(&boxcar[c], 1u << CHAIN_SHIFT(chain));
+                    decimate_cic_init(&cic[c], 1u << CHAIN_SHIFT(chain));
+                    decimate_peak_init(&peak[c], 2u << CHAIN_SHIFT(chain));
+                    // scan skew in output samples (both are 1/256 of a sample)
+                    capture_set_channel_skew(c, adc_stream_channel_skew(c) >> CHAIN_SHIFT(chain));
+                }
+                // min / max pairs are raw samples, the averages carry the extra bits
+                capture_set_sample_bits(boxcar[0].factor > 1 && !CHAIN_PEAK(chain) ? DECIMATE_FRAC_BITS : 0);
+                capture_set_sample_rate(CHAIN_RATE(chain) >> CHAIN_SHIFT(chain));
+            }
+            if (block->rate_hz != CHAIN_RATE(chain)) {
+                block_ring_release(&adc_ring); // sampled before the switch
+                continue;
+            }
+            if (block->range != range) {
+                // new input range: filter history at the old scale must not leak into the
+                // first outputs, and capture starts a fresh record
+                range = block->range;
+                for (int c = 0; c < ADC_STREAM_NUM_CHANNELS; c++) {
+                    decimate_boxcar_init(&boxcar[c], 1u << CHAIN_SHIFT(chain));
+                    decimate_cic_init(&cic[c], 1u << CHAIN_SHIFT(chain));
+                    decimate_peak_init(&peak[c], 2u << CHAIN_SHIFT(chain));
+                }
+                capture_set_range(range, ADC_RANGES[range].code_scale);
+            }
+
+            size_t n = block->count;
+            uint64_t t0 = block->timestamp;
+            if (boxcar[0].factor > 1 && CHAIN_PEAK(chain)) {
+                // a pair per 2x group keeps the output rate, the group's first sample stamps it
+                t0 -= (uint64_t)decimate_peak_pending(&peak[0]) * TIMER_RESOLUTION_HZ / block->rate_hz;
+                for (int c = 0; c < ADC_STREAM_NUM_CHANNELS; c++) {
+                    n = decimate_peak(&peak[c], block->samples[c], block->count, dec[c]);
+                    lanes[c] = dec[c];
+                }
+            } else if (boxcar[0].factor > 1 && CHAIN_AA(chain)) {
+                // outputs lag the boxcar convention by the filter delay, stamp them where they belong
+                t0 -= (uint64_t)(decimate_cic_pending(&cic[0]) + decimate_cic_delay(&cic[0])) *
+                      TIMER_RESOLUTION_HZ / block->rate_hz;
+                for (int c = 0; c < ADC_STREAM_NUM_CHANNELS; c++) {
+                    n = decimate_cic(&cic[c], block->samples[c], block->count, dec[c]);
+                    lanes[c] = dec[c];
+                }
+            } else if (boxcar[0].factor > 1) {
+                // first output sample starts with the group carried over from the last block
+                t0 -= (uint64_t)decimate_boxcar_pending(&boxcar[0]) * TIMER_RESOLUTION_HZ / block->rate_hz;
+                for (int c = 0; c < ADC_STREAM_NUM_CHANNELS; c++) {
+                    n = decimate_boxcar(&boxcar[c], block->samples[c], block->count, dec[c]);
+                    lanes[c] = dec[c];
+                }
+            } else {
+                for (int c = 0; c < ADC_STREAM_NUM_CHANNELS; c++) { lanes[c] = block->samples[c];}
+            }
+            capture_write_channels(lanes, n, t0);
+            block_ring_release(&adc_ring);
+        }
+    }
+}
+
+// points the sampler at the display rate the timebase wants. below the slowest stream rate
+// the ADC runs a power of two faster and the boxcar brings it back down (averaging the
+// extra samples into Q12.4 instead of dropping them). hi-res asks for at least
+// HIRES_OVERSAMPLE, as far as the hardware goes. peak detect keeps the min and max of
+// every two output periods instead, so a glitch shorter than one still gets drawn. the
+// sample task swaps over glitch free
+static void configure_sampling(void)
+{
+    uint32_t rate = waveform_display_sample_rate();
+    uint32_t shift = 0;
+    while ((rate << shift) < ADC_STREAM_MIN_RATE_HZ) { shift++;}
+    while (hires_on && (1u << shift) < HIRES_OVERSAMPLE && (rate << (shift + 1)) <= adc_stream_max_rate()) {
+        shift++;
+    }
+    // the CIC tops out at DECIMATE_CIC_MAX_FACTOR, past that it's the boxcar
+    uint32_t aa = !peak_on && waveform_display_anti_alias() && (1u << shift) <= DECIMATE_CIC_MAX_FACTOR;
+    atomic_store_explicit(&chain_req, CHAIN(rate << shift, shift, aa, peak_on), memory_order_release);
+    ESP_ERROR_CHECK(adc_stream_set_rate(rate << shift));
+    ESP_LOGI(TAG, "%lu S/s, stream %lu S/s (%lux %s)", (unsigned long)rate,
+             (unsigned long)(rate << shift), 1ul << shift, peak_on ? "peak" : aa ? "cic" : "boxcar");
+}
+
+// auto-ranging, after each record: one step to a wider input range as soon as a record
+// gets near the top of the current one, a narrower range only once the peak has fit it
+// with room to spare for ADC_RANGE_DOWN_RECORDS records in a row. every range starts at
+// the bottom code, so the peak (the most negative input, the front end inverts) decides
+static void autorange(const capture_frame_t *f)
+{
+    static uint32_t fits = 0;
+    int cur = adc_stream_get_range();
+    if (f == NULL || (int)f->range != cur) { return;} // taken before the last switch
+
+    uint32_t peak = 0;
+    for (uint32_t c = 0; c < f->channels; c++) {
+        uint16_t lo, hi;
+        capture_view_minmax(&f->ch[c], 0, f->ch[c].len, &lo, &hi);
+        if (hi > peak) { peak = hi;}
+    }
+    peak >>= f->frac_bits;
+
+    if (peak >= 4095 * ADC_RANGE_UP_PCT / 100) {
+        fits = 0;
+        if (cur < ADC_RANGE_12DB) {
+            ESP_ERROR_CHECK(adc_stream_set_range(cur + 1));
+            ESP_LOGI(TAG, "input range %d -> %d", cur, cur + 1);
+        }
+        return;
+    }
+
+    // narrowest range the peak fits with the margin
+    uint32_t ref = adc_range_to_ref(cur, peak);
+    int want = cur;
+    for (int r = cur - 1; r >= 0; r--) {
+        if (ref * ADC_RANGE_SCALE_ONE / ADC_RANGES[r].code_scale >= 4095 * ADC_RANGE_DOWN_PCT / 100) { break;}
+        want = r;
+    }
+    fits = (want < cur) ? fits + 1 : 0;
+    if (fits >= ADC_RANGE_DOWN_RECORDS) {
+        fits = 0;
+        ESP_ERROR_CHECK(adc_stream_set_range(want));
+        ESP_LOGI(TAG, "input range %d -> %d", cur, want);
+    }
+}
+
+// rising voltage edge through mid screen. the front end inverts, so on raw codes it falls
+static const trigger_config_t trig_cfg = {
+    .type = TRIGGER_TYPE_EDGE,
+    .edge = TRIGGER_FALLING,
+    .level = TRIGGER_LEVEL,
+    .hysteresis = TRIGGER_HYSTERESIS,
+};
+
+// acquisition health: logged when anything was lost since the last call
+static void log_health(void)
+{
+    static uint32_t last_total = 0;
+    adc_stream_stats_t st;
+    adc_stream_get_stats(&st);
+    uint32_t ring = block_ring_overrun_blocks(&adc_ring);
+    uint32_t lost = atomic_load_explicit(&lost_blocks, memory_order_relaxed);
+    uint32_t gaps = capture_gaps_marked();
+    uint32_t total = st.pool_overflows + ring + lost + gaps;
+    if (total == last_total) { return;}
+    last_total = total;
+    ESP_LOGW(TAG, "%lu blocks: %lu driver overflows, %lu ring overruns (%lu samples), %lu blocks missing, "
+             "%lu gaps marked, %lu samples with no frame to go to",
+             (unsigned long)st.blocks, (unsigned long)st.pool_overflows, (unsigned long)ring,
+             (unsigned long)block_ring_overrun_samples(&adc_ring), (unsigned long)lost,
+             (unsigned long)gaps, (unsigned long)capture_lost_samples());
+}
+
+// share of each core's time outside its idle task since the last call, in %. false
+// without FreeRTOS run time stats
+static bool core_load(uint32_t load[portNUM_PROCESSORS])
+{
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    static configRUN_TIME_COUNTER_TYPE last_now = 0;
+    static configRUN_TIME_COUNTER_TYPE last_idle[portNUM_PROCESSORS];
+    configRUN_TIME_COUNTER_TYPE now = portGET_RUN_TIME_COUNTER_VALUE();
+    for (int c = 0; c < portNUM_PROCESSORS; c++) {
+        configRUN_TIME_COUNTER_TYPE idle = ulTaskGetRunTimeCounter(xTaskGetIdleTaskHandleForCore(c));
+        uint32_t idle_pct = (uint32_t)((uint64_t)(idle - last_idle[c]) * 100 / (now - last_now));
+        load[c] = (idle_pct < 100) ? 100 - idle_pct : 0;
+        last_idle[c] = idle;
+    }
+    last_now = now;
+    return true;
+#else
+    for (int c = 0; c < portNUM_PROCESSORS; c++) { load[c] = 0;}
+    return false;
+#endif
+}
+
+// at the top sample rate the acquisition core should keep some idle left, or the sample
+// task falls behind
+static void log_core_load(void)
+{
+    uint32_t load[portNUM_PROCESSORS];
+    if (!core_load(load)) { return;}
+    ESP_LOGI(TAG, "core load: acquisition (core %d) %lu%%, display (core %d) %lu%%, stream %lu S/s",
+             ACQ_CORE, (unsigned long)load[ACQ_CORE], UI_CORE, (unsigned long)load[UI_CORE],
+             (unsigned long)adc_stream_get_rate());
+}
+
+// frame interrupt interval percentiles (ADC_JITTER_HIST builds), then starts a new window.
+// a late interrupt is a late block timestamp, and a pile-up of them ends in a pool overflow
+static void log_jitter(void)
+{
+    adc_stream_jitter_t j;
+    if (!adc_stream_get_jitter(&j)) { return;}
+    ESP_LOGI(TAG, "irq interval over %lu frames: p50 %lu us, p99 %lu us, max %lu us (nominal %lu us)",
+             (unsigned long)j.count, (unsigned long)(j.p50_ns / 1000), (unsigned long)(j.p99_ns / 1000),
+             (unsigned long)(j.max_ns / 1000), (unsigned long)(j.nominal_ns / 1000));
+    adc_stream_reset_isr_interval();
+}
+
+// rate sweep: sits out ms worth of frame ticks, drawing the newest record every other one
+// (as often as the fastest timebase redraws) when the display is on
+static void sweep_wait(uint32_t ms, bool display)
+{
+    for (uint32_t f = 0; f < ms / FRAME_PERIOD_MS; f++) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (display && (f & 1)) { waveform_display_draw_any_rate();}
+    }
+}
+
+// rate sweep: runs the stream at rate for RATE_SWEEP_DWELL_MS and logs what it lost, the
+// frame interrupt intervals against the nominal one and the load on both cores. capture
+// gets every sample undecimated, the most the sample task ever has to do. true if nothing
+// was lost anywhere between the driver and the capture frames
+static bool sweep_rate(uint32_t rate, bool display)
+{
+    atomic_store_explicit(&chain_req, CHAIN(rate, 0, 0, 0), memory_order_release);
+    ESP_ERROR_CHECK(adc_stream_set_rate(rate));
+    sweep_wait(RATE_SWEEP_SETTLE_MS, display);
+
+    adc_stream_stats_t st0, st1;
+    uint32_t load[portNUM_PROCESSORS];
+    adc_stream_get_stats(&st0);
+    uint32_t ring0 = block_ring_overrun_blocks(&adc_ring);
+    uint32_t missing0 = atomic_load_explicit(&lost_blocks, memory_order_relaxed);
+    uint32_t nofr0 = capture_lost_samples();
+    adc_stream_reset_isr_interval();
+    core_load(load);
+
+    sweep_wait(RATE_SWEEP_DWELL_MS, display);
+
+    adc_stream_get_stats(&st1);
+    bool have_load = core_load(load);
+    uint32_t blocks = st1.blocks - st0.blocks;
+    uint32_t ovf = st1.pool_overflows - st0.pool_overflows;
+    uint32_t ring = block_ring_overrun_blocks(&adc_ring) - ring0;
+    uint32_t missing = atomic_load_explicit(&lost_blocks, memory_order_relaxed) - missing0;
+    uint32_t nofr = capture_lost_samples() - nofr0;
+    bool clean = blocks > 0 && ovf + ring + missing + nofr == 0;
 
-            waveform_display_add_sample(val);
+    uint32_t nominal_us = (uint32_t)((uint64_t)ADC_STREAM_BLOCK_SAMPLES * 1000000 / rate);
+    ESP_LOGI(TAG, "sweep %7lu S/s display %-3s: %s, %lu blocks, %lu overflows, %lu ring overruns, "
+             "%lu missing, %lu no frame, irq every %lu..%lu us (nominal %lu), load acq %lu%% ui %lu%%%s",
+             (unsigned long)rate, display ? "on" : "off", clean ? "ok  " : "LOST", (unsigned long)blocks,
+             (unsigned long)ovf, (unsigned long)ring, (unsigned long)missing, (unsigned long)nofr,
+             (unsigned long)(st1.isr_interval_min_ns / 1000), (unsigned long)(st1.isr_interval_max_ns / 1000),
+             (unsigned long)nominal_us, (unsigned long)load[ACQ_CORE], (unsigned long)load[UI_CORE],
+             have_load ? "" : " (no run time stats)");
+    log_jitter();
+    return clean;
+}
+
+// characterization: steps the stream rate up geometrically from the slowest rate to the
+// hardware max, first with the display drawing and then with it idle, until a step loses
+// samples. RATE_SWEEP_REFINE halvings then close in on the edge. the summary line is the
+// one to keep from release to release
+static void rate_sweep(void)
+{
+    uint32_t lo = ADC_STREAM_MIN_RATE_HZ;
+    uint32_t hi = adc_stream_max_rate();
+    uint32_t best[2];
+    ESP_LOGI(TAG, "rate sweep: %lu..%lu S/s, %d channels, %d ms per step",
+             (unsigned long)lo, (unsigned long)hi, ADC_STREAM_NUM_CHANNELS, RATE_SWEEP_DWELL_MS);
+    lcd_drawString(5, 5, "RATE SWEEP", FROZEN_TXT_COLOR);
+
+    for (int d = 0; d < 2; d++) {
+        bool display = (d == 0);
+        uint32_t ok = 0, bad = 0;
+        for (int i = 0; i < RATE_SWEEP_STEPS && bad == 0; i++) {
+            uint32_t rate = (i == RATE_SWEEP_STEPS - 1) ? hi :
+                            (uint32_t)(lo * powf((float)hi / lo, (float)i / (RATE_SWEEP_STEPS - 1)));
+            if (sweep_rate(rate, display)) { ok = rate;} else { bad = rate;}
+        }
+        // nothing to close in on if even the slowest rate lost samples
+        for (int i = 0; i < RATE_SWEEP_REFINE && ok != 0 && bad != 0; i++) {
+            uint32_t mid = ok + (bad - ok) / 2;
+            if (sweep_rate(mid, display)) { ok = mid;} else { bad = mid;}
         }
+        best[d] = ok;
+    }
+
+    const esp_app_desc_t *app = esp_app_get_description();
+    ESP_LOGI(TAG, "rate sweep result: firmware %s (%s), %d channels: lossless up to %lu S/s with the display, "
+             "%lu S/s without%s (hardware max %lu S/s)", app->version, app->date, ADC_STREAM_NUM_CHANNELS,
+             (unsigned long)best[0], (unsigned long)best[1], (best[0] == hi) ? ", both at the limit" :
+             (best[1] == hi) ? ", the latter at the limit" : "", (unsigned long)hi);
+
+    lcd_drawString(5, 5, "RATE SWEEP", WHITE);
+    configure_sampling(); // back to the timebase
+}
+
+// segmented run done: log the re-arm latency and the tightest spacing between segments
+static void report_segments(void)
+{
+    uint32_t n = capture_segments_done();
+    if (n < 2) { return;}
+    uint32_t rate = capture_segment(0)->rate_hz;
+    uint32_t lat_min = UINT32_MAX, lat_max = 0;
+    uint64_t gap_min = UINT64_MAX;
+    // the first segment's blind time is just the pre-trigger fill after the arm, so skip it
+    for (uint32_t i = 1; i < n; i++) {
+        const capture_frame_t *seg = capture_segment(i);
+        if (seg->rearm_samples < lat_min) { lat_min = seg->rearm_samples;}
+        if (seg->rearm_samples > lat_max) { lat_max = seg->rearm_samples;}
+        uint64_t gap = seg->timestamp - capture_segment(i - 1)->timestamp;
+        if (gap < gap_min) { gap_min = gap;}
     }
+    ESP_LOGI(TAG, "%lu segments, re-arm latency %lu..%lu samples (%lu..%lu us), closest triggers %llu us apart",
+             (unsigned long)n, (unsigned long)lat_min, (unsigned long)lat_max,
+             (unsigned long)((uint64_t)lat_min * 1000000 / rate), (unsigned long)((uint64_t)lat_max * 1000000 / rate),
+             (unsigned long long)(gap_min * 1000000 / TIMER_RESOLUTION_HZ));
 }
 
 // Button Config
@@ -74,30 +416,10 @@ static void config_btns(void)
     button_init(BTN_A);
     button_init(BTN_B);
     button_init(BTN_MENU);
+    button_init(BTN_OPTION);
+    button_init(BTN_SELECT);
 }
 
-// config structs
-static const adc_oneshot_unit_init_cfg_t adc_init_cfg = {
-    .unit_id = ADC_UNIT_2
-};
-static const adc_oneshot_chan_cfg_t adc_chan_cfg = {
-    .bitwidth = ADC_BITWIDTH_12,
-    .atten = ADC_ATTEN_DB_12
-};
-static const gptimer_config_t timer_cfg = {
-    .clk_src = GPTIMER_CLK_SRC_DEFAULT,
-    .direction = GPTIMER_COUNT_UP,
-    .resolution_hz = TIMER_RESOLUTION_HZ,
-};
-static const gptimer_alarm_config_t alarm_cfg = {
-    .alarm_count = ALARM_INTERVAL_US,
-    .reload_count = 0,
-    .flags.auto_reload_on_alarm = true,
-};
-static const gptimer_event_callbacks_t timer_cbs = {
-    .on_alarm = timer_callback,
-};
-
 
 void app_main(void)
 {
@@ -105,7 +427,7 @@ void app_main(void)
     main_task_handle = xTaskGetCurrentTaskHandle();
 
     // init setups
-    esp_wifi_stop(); // force wifi off to use ADC2
+    esp_wifi_stop(); // the probe is on ADC1 now, wifi off is only for adc_logger's ADC2 input
     esp_wifi_deinit(); // ^^
     lcd_init();
     joystick_init();
@@ -122,26 +444,36 @@ void app_main(void)
     );
     xTimerStart(frame_timer, 0);
 
-    // ADC setup
-    adc_oneshot_new_unit(&adc_init_cfg, &adc_handle);
-    adc_oneshot_config_channel(adc_handle, ADC_CHANNEL, &adc_chan_cfg);
-    // ADC queue setup
-    adc_queue = xQueueCreate(ADC_QUEUE_LENGTH, sizeof(uint16_t));
-    // create ADC task BEFORE starting timer
-    xTaskCreate(adc_sample_task, "adc_task", 4096, NULL, 3, NULL);
-
-    // timer setup
-    gptimer_new_timer(&timer_cfg, &gptimer);
-    gptimer_register_event_callbacks(gptimer, &timer_cbs, NULL); //register ISR
-    gptimer_set_alarm_action(gptimer, &alarm_cfg); // setup alarm
-    gptimer_enable(gptimer);
-    gptimer_start(gptimer);
+    // ADC block ring + trigger + capture store setup
+    block_ring_init(&adc_ring);
+    trigger_configure(&trig_cfg);
+    capture_set_channels(ADC_STREAM_NUM_CHANNELS);
+    capture_init();
+    capture_set_holdoff(TRIGGER_HOLDOFF_SAMPLES);
+    // create ADC task BEFORE starting the stream
+    xTaskCreatePinnedToCore(adc_sample_task, "adc_task", 4096, NULL, 3, &adc_task_handle, ACQ_CORE);
+
+    // DMA stream setup (joystick_init already took its baseline, ADC1 is free now)
+    ESP_ERROR_CHECK(adc_stream_init(waveform_display_sample_rate(), adc_block_cb, NULL));
+    configure_sampling();
+    ESP_ERROR_CHECK(adc_stream_start());
+    capture_set_segments(CAPTURE_SEGMENTS);
+
+    if (RATE_SWEEP_AT_BOOT || btn_pressed(BTN_SELECT)) { rate_sweep();}
 
     // Button state tracking for debouncing
     bool btn_a_prev = false;
     bool btn_b_prev = false;
     bool btn_menu_prev = false;
-    bool frozen = false;
+    bool btn_option_prev = false;
+    bool btn_select_prev = btn_pressed(BTN_SELECT); // may still be held from a boot sweep
+    bool frozen = false;                          // single shot record / segments held on screen
+    capture_mode_t run_mode = CAPTURE_MODE_AUTO;  // what btn B goes back to after a single shot
+    uint32_t seg_idx = 0;                         // segment on screen
+    uint32_t seg_shown = 0;                       // segments counted on screen so far
+    int joy_step_prev = 0;
+    uint32_t health_frames = 0;
+    uint32_t load_frames = 0;
 
     // main display loop
     while (1)
@@ -152,48 +484,131 @@ void app_main(void)
         bool btn_a = btn_pressed(BTN_A);
         bool btn_b = btn_pressed(BTN_B);
         bool btn_menu = btn_pressed(BTN_MENU);
+        bool btn_option = btn_pressed(BTN_OPTION);
+        bool btn_select = btn_pressed(BTN_SELECT);
 
-        // bnt A pressed so freeze screen 
+        // btn A pressed so arm a single shot (or a new set of segments). the next triggered record gets frozen
         if (btn_a && !btn_a_prev) {
-            frozen = true;
-            lcd_drawString(5, 5, "SCREEN FROZEN", FROZEN_TXT_COLOR);
+            if (capture_get_mode() != CAPTURE_MODE_SEGMENTED) { capture_set_mode(CAPTURE_MODE_SINGLE);}
+            capture_arm_single();
+            seg_shown = 0;
+            frozen = false;
+            lcd_drawString(5, 5, FROZEN_TXT, WHITE);
+            lcd_drawString(5, 5, ARMED_TXT, FROZEN_TXT_COLOR);
+            waveform_display_draw_mode();
             // reset joystick pos to center
             joystick_pos.y = 0;
         }
 
-        // btn B pressed so unfreeze if
-        if (frozen && btn_b && !btn_b_prev) {
+        // btn B pressed so leave single shot, or cycle auto -> normal -> segmented when already running
+        if (btn_b && !btn_b_prev) {
+            if (capture_get_mode() != CAPTURE_MODE_SINGLE) {
+                run_mode = (run_mode == CAPTURE_MODE_AUTO)   ? CAPTURE_MODE_NORMAL :
+                           (run_mode == CAPTURE_MODE_NORMAL) ? CAPTURE_MODE_SEGMENTED : CAPTURE_MODE_AUTO;
+            }
+            capture_set_mode(run_mode);
+            if (run_mode == CAPTURE_MODE_SEGMENTED) { capture_arm_single();} // always a fresh set
+            seg_shown = 0;
             frozen = false;
-            lcd_drawString(5, 5, "SCREEN FROZEN", WHITE);
+            lcd_drawString(5, 5, FROZEN_TXT, WHITE);
+            lcd_drawString(5, 5, ARMED_TXT, WHITE);
+            waveform_display_draw_mode();
         }
 
-        // btn MENU pressed so cycle timebase and unfreeze
+        // btn MENU pressed so cycle timebase (and the sample rate with it). a single shot
+        // re-arms with the new record length
         if (btn_menu && !btn_menu_prev) {
             cycle_timebase_mode();
+            configure_sampling();
+            if (capture_get_mode() == CAPTURE_MODE_SINGLE || capture_get_mode() == CAPTURE_MODE_SEGMENTED) {
+                capture_arm_single();
+                lcd_drawString(5, 5, ARMED_TXT, FROZEN_TXT_COLOR);
+            }
             frozen = false;
-            lcd_drawString(5, 5, "SCREEN FROZEN", WHITE);
+        }
+
+        // btn OPTION pressed so cycle the acquisition mode (sample / peak detect)
+        if (btn_option && !btn_option_prev) {
+            acq_mode_t acq = cycle_acq_mode();
+            if (hires_on != (acq == ACQ_MODE_HIRES) || peak_on != (acq == ACQ_MODE_PEAK)) {
+                hires_on = (acq == ACQ_MODE_HIRES);
+                peak_on = (acq == ACQ_MODE_PEAK);
+                configure_sampling();
+            }
+        }
+
+        // btn SELECT pressed so switch linear / sinc upsampling (only matters on timebases
+        // with fewer samples than columns)
+        if (btn_select && !btn_select_prev) {
+            cycle_interp_mode();
         }
 
         // update joystick every frame if frozen or not
         joystick_read(&joystick_pos);
 
-        // Only draw waveform if not frozen
-        if (!frozen) {
-            int redraw_interval = get_redraw_interval();
-            if (frame_count % redraw_interval == 0) {
-                waveform_display_draw_full_frame();
+        // segmented: count the segments coming in, then hold them and show the first
+        if (!frozen && capture_get_mode() == CAPTURE_MODE_SEGMENTED) {
+            uint32_t done = capture_segments_done();
+            uint32_t total = capture_segments_total();
+            if (done != seg_shown) {
+                char txt[16];
+                snprintf(txt, sizeof(txt), "%s %lu/%lu", ARMED_TXT, (unsigned long)done, (unsigned long)total);
+                lcd_fillRect(5, 5, 90, 10, BACKGROUND_COLOR);
+                lcd_drawString(5, 5, txt, FROZEN_TXT_COLOR);
+                seg_shown = done;
+            }
+            if (done > 0 && done == total) {
+                frozen = true;
+                seg_idx = 0;
+                waveform_display_draw_segment(seg_idx);
+                lcd_drawString(5, 5, FROZEN_TXT, FROZEN_TXT_COLOR);
+                report_segments();
+            }
+        // Only draw waveform if not frozen. redraw when a new record is in, but no faster than the interval
+        } else if (!frozen) {
+            if (frame_count >= get_redraw_interval() && waveform_display_draw_full_frame()) {
                 frame_count = 0;
+                // single shot record is in: hold it for the cursor
+                if (capture_get_mode() == CAPTURE_MODE_SINGLE) {
+                    frozen = true;
+                    lcd_drawString(5, 5, FROZEN_TXT, FROZEN_TXT_COLOR);
+                } else if (ADC_AUTORANGE) {
+                    autorange(capture_held_frame());
+                }
             }
-            frame_count++;
+            if (frame_count < UINT8_MAX) { frame_count++;}
         } else {
+            // joystick X steps through the segments, one step per deflection
+            if (capture_get_mode() == CAPTURE_MODE_SEGMENTED) {
+                int joy_step = (joystick_pos.x > JOY_STEP_THRESHOLD) - (joystick_pos.x < -JOY_STEP_THRESHOLD);
+                uint32_t total = capture_segments_done();
+                if (joy_step != 0 && joy_step != joy_step_prev && total > 0) {
+                    seg_idx = (seg_idx + total + joy_step) % total;
+                    waveform_display_draw_segment(seg_idx);
+                    lcd_drawString(5, 5, FROZEN_TXT, FROZEN_TXT_COLOR);
+                }
+                joy_step_prev = joy_step;
+            }
             int y_curr = joystick_pos.y;
             cursor_update(frozen, y_curr);
         }
         
+        if (++health_frames >= HEALTH_LOG_MS / FRAME_PERIOD_MS) {
+            health_frames = 0;
+            log_health();
+        }
+        if (++load_frames >= CORE_LOAD_LOG_MS / FRAME_PERIOD_MS) {
+            load_frames = 0;
+            log_core_load();
+            log_jitter();
+        }
+
         // reset btns
         btn_a_prev = btn_a;
         btn_b_prev = btn_b;
         btn_menu_prev = btn_menu;
+        btn_option_prev = btn_option;
+        btn_select_prev = btn_select;
     }
 
 }
\ No newline at end of file
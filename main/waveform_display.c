@@ -4,16 +4,40 @@
 #include "lcd.h"
 #include "math.h"
 #include "joystick_dma.h"
+#include "capture.h"
+#include "trigger.h"
+#include "interp.h"
+#include "adc_stream.h"
 #include <stdio.h>
 
-#define SLOPE_CONVERSION     17.06f // got this by simple math
-#define DECIMATION_AMT       (SAMPLE_BUFFER_SIZE / LCD_W)
+#define CODES_PER_ROW_X100   1706 // 12 dB codes per screen row, x100. got this by simple math
 
-static uint16_t sample_buffer[SAMPLE_BUFFER_SIZE];
-static volatile uint32_t sample_write_index = 0;
 static int wave_x = 0;
 static int last_y = -1; // starting cursor y position
-static int drawn_y_values[HW_LCD_W]; // to track drawn waveform y values
+static int drawn_y_values[CAPTURE_MAX_CHANNELS][HW_LCD_W]; // to track drawn waveform y values, per channel
+static int drawn_y_ends[CAPTURE_MAX_CHANNELS][HW_LCD_W];   // other end of the column's span in peak detect (== drawn_y_values otherwise)
+static int drawn_channels = 1; // traces currently on screen
+static const uint16_t ch_colors[] = SCOPE_CH_COLORS;
+static const int ch_offsets[] = SCOPE_CH_OFFSETS;
+static uint16_t drawn_samples[HW_LCD_W]; // sample behind drawn_y_values, full precision for the cursor readout
+static uint16_t drawn_samples_hi[HW_LCD_W]; // and behind drawn_y_ends: the column maximum in peak detect, else the same
+static int drawn_bits = 0;           // frac_bits of the drawn record
+static int drawn_range = ADC_RANGE_12DB; // input range of the drawn record
+static acq_mode_t acq_mode = ACQ_MODE_SAMPLE;
+static interp_kind_t interp_kind = DISPLAY_INTERP;
+
+// 12 dB code -> screen row, midscale on the middle one
+static int ref_to_y(int32_t code)
+{
+    return (code - ADC_MIDPOINT) * 100 / CODES_PER_ROW_X100 + LCD_MID_HORIZONTAL;
+}
+
+// code of the drawn record's range -> screen row. codes go through the 12 dB scale so
+// every input range draws at the same volts per division
+static int raw_to_y(uint16_t adc_raw)
+{
+    return ref_to_y(adc_range_to_ref(drawn_range, adc_raw));
+}
 
 // ----------------- cursor stuff ------------------------------------
 // -------------------------------------------------------------------
@@ -28,16 +52,36 @@ static void draw_cursor(int x, int y, uint16_t color)
 // used to fix the waveform when cursor draws over it
 void restore_waveform_row(int last_y)
 {
+    // peak detect columns are vertical spans
+    if (acq_mode == ACQ_MODE_PEAK) {
+        for (int c = 0; c < drawn_channels; c++)
+        {
+            for (int x = 0; x < wave_x; x++)
+            {
+                int y0 = drawn_y_values[c][x];
+                int y1 = drawn_y_ends[c][x];
+                if ((y0 <= last_y && y1 >= last_y) || (y1 <= last_y && y0 >= last_y))
+                {
+                    lcd_drawLine(x, y0, x, y1, ch_colors[c]);
+                }
+            }
+        }
+        return;
+    }
+
     // only fix columns that have already been drawn
-    for (int x = 1; x < wave_x; x++)
+    for (int c = 0; c < drawn_channels; c++)
     {
-        int y0 = drawn_y_values[x];
-        int y1 = drawn_y_values[x - 1];
-
-        // Does the cursor cross the waveform segment between y1 to y0
-        if ((y0 <= last_y && y1 >= last_y) || (y1 <= last_y && y0 >= last_y))
+        for (int x = 1; x < wave_x; x++)
         {
-            lcd_drawLine(x - 1, y1, x, y0, WAVEFORM_COLOR);
+            int y0 = drawn_y_values[c][x];
+            int y1 = drawn_y_values[c][x - 1];
+
+            // Does the cursor cross the waveform segment between y1 to y0
+            if ((y0 <= last_y && y1 >= last_y) || (y1 <= last_y && y0 >= last_y))
+            {
+                lcd_drawLine(x - 1, y1, x, y0, ch_colors[c]);
+            }
         }
     }
 }
@@ -45,56 +89,138 @@ void restore_waveform_row(int last_y)
 // ----------------- timebase stuff ----------------------------------
 // -------------------------------------------------------------------
 
-typedef enum {
-    TIMEBASE_8MS,
-    TIMEBASE_16MS,
-    TIMEBASE_32MS,
-    TIMEBASE_64MS,
-    TIMEBASE_160MS,
-    TIMEBASE_320MS,
-    TIMEBASE_640MS,
-    NUM_TIMEBASE_MODES
-} timebase_mode_t;
-
-static timebase_mode_t current_timebase = TIMEBASE_32MS;
-
-char* timebase_str[] = {
-    "8ms/div",
-    "16ms/div",
-    "32ms/div",
-    "64ms/div",
-    "160ms/div",
-    "320ms/div",
-    "640ms/div"
+// 1-2-5 sequence, time per grid division. the screen is SCREEN_DIVS divisions wide and the
+// sample rate, label and redraw interval all follow from the entry. anti_alias picks the
+// CIC + FIR decimator over the plain boxcar where the stream runs faster than the display rate
+#define SCREEN_DIVS         (NUM_GRID_LINES + 1)
+#define SCREEN_SAMPLES      (HW_LCD_W * SAMPLES_PER_COLUMN)
+typedef struct {
+    uint32_t us_per_div;
+    bool anti_alias;
+} timebase_t;
+
+static const timebase_t timebases[] = {
+    { 20,     false },
+    { 50,     false },
+    { 100,    false },
+    { 200,    false },
+    { 500,    false },
+    { 1000,   false },
+    { 2000,   false },
+    { 5000,   false },
+    { 10000,  false },
+    { 20000,  DECIMATE_ANTI_ALIAS },
+    { 50000,  DECIMATE_ANTI_ALIAS },
+    { 100000, DECIMATE_ANTI_ALIAS },
+    { 200000, DECIMATE_ANTI_ALIAS },
 };
+#define NUM_TIMEBASE_MODES  (sizeof(timebases) / sizeof(timebases[0]))
 
-static float get_screen_time_window(void)
+static uint32_t current_timebase = 7; // 5ms/div
+static char timebase_str[12];
+
+// "500us/div", "2ms/div", ... for the current entry
+static void format_timebase_label(void)
 {
-    switch (current_timebase) {
-        case TIMEBASE_8MS:   return 0.008f;
-        case TIMEBASE_16MS:  return 0.016f;
-        case TIMEBASE_32MS:  return 0.032f;
-        case TIMEBASE_64MS:  return 0.064f;
-        case TIMEBASE_160MS: return 0.160f;
-        case TIMEBASE_320MS: return 0.320f;
-        case TIMEBASE_640MS: return 0.640f;
-        default:             return 0.032f;
+    uint32_t us = timebases[current_timebase].us_per_div;
+    if (us < 1000) {
+        snprintf(timebase_str, sizeof(timebase_str), "%luus/div", (unsigned long)us);
+    } else {
+        snprintf(timebase_str, sizeof(timebase_str), "%lums/div", (unsigned long)(us / 1000));
     }
 }
 
-// determine decimation factor based on timebase
-static int get_decimation_factor(void)
+// whole screen in microseconds
+static uint32_t get_screen_us(void)
+{
+    return timebases[current_timebase].us_per_div * SCREEN_DIVS;
+}
+
+// rate for SCREEN_SAMPLES per screen, as far as the ADC goes. fast timebases get fewer
+// samples than columns and are upsampled when drawn. main sets the sampler up for it
+uint32_t waveform_display_sample_rate(void)
+{
+    uint64_t rate = (uint64_t)SCREEN_SAMPLES * 1000000 / get_screen_us();
+    return (rate > adc_stream_max_rate()) ? adc_stream_max_rate() : rate;
+}
+
+// whether the current timebase wants the anti-alias decimator
+bool waveform_display_anti_alias(void)
+{
+    return timebases[current_timebase].anti_alias;
+}
+
+// samples one screen width covers at the current rate
+static uint32_t get_screen_samples(void)
+{
+    return ((uint64_t)waveform_display_sample_rate() * get_screen_us() + 500000) / 1000000;
+}
+
+// samples per column in fixed point (TRIGGER_FRAC_BITS), so fast timebases get their real
+// width (fewer samples than columns) and the trace can move by fractions of a sample
+static uint32_t get_column_step(void)
 {
-    float screen_time_window = get_screen_time_window();
-    float samples_per_screen = SAMPLE_RATE_HZ * screen_time_window;
-    int dec = samples_per_screen / LCD_W;
-    if (dec < 1) { dec = 1;} // can’t plot >1 sample per pixel
-    return dec;
+    uint32_t step = (get_screen_samples() << TRIGGER_FRAC_BITS) / LCD_W;
+    return (step < 1) ? 1 : step;
+}
+
+// samples a record needs to cover the screen (at least LCD_W, so the record always
+// outlasts the pre-trigger column)
+static uint32_t get_record_span(void)
+{
+    uint32_t samples_per_screen = get_screen_samples();
+    return (samples_per_screen < LCD_W) ? LCD_W : samples_per_screen;
+}
+
+// record value under a column at pos (1/TRIGGER_FRAC_ONE samples), reconstructed between the
+// samples rather than snapped to one. the column step is fractional too, so any sample count
+// lands on exactly LCD_W columns and fast timebases with fewer samples than columns are upsampled
+static uint16_t column_sample(const capture_view_t *view, uint32_t pos, int bits)
+{
+    int32_t v = interp_at(view, pos << INTERP_FRAC_BITS >> TRIGGER_FRAC_BITS, interp_kind);
+    int32_t top = 4095 << bits; // sinc rings past the rails on steep edges
+    return (v < 0) ? 0 : (v > top) ? top : v;
+}
+
+// hands the record shape for the current timebase to the capture state machine
+static void configure_record(void)
+{
+    uint32_t span = get_record_span();
+    capture_set_record(span, span * TRIGGER_PRETRIGGER_PCT / 100);
 }
 
 // ----------------- grid + cursor stuff -----------------------------
 // -------------------------------------------------------------------
 
+// small arrows for where the record triggered (top) and at what level (right edge)
+static void draw_trigger_marker(int trig_x)
+{
+    int level_y = ref_to_y(trigger_get_config()->level) + ch_offsets[0];
+    lcd_fillTriangle(trig_x - 3, 0, trig_x + 3, 0, trig_x, 5, TRIGGER_COLOR);
+    lcd_fillTriangle(LCD_W - 1, level_y - 3, LCD_W - 1, level_y + 3, LCD_W - 6, level_y, TRIGGER_COLOR);
+}
+
+// small arrows along the bottom where samples were lost inside the record: the trace is
+// joined straight across them
+static void draw_gap_markers(const capture_frame_t *frame, int32_t first, int32_t step)
+{
+    uint32_t n = (frame->gaps < CAPTURE_MAX_GAPS) ? frame->gaps : CAPTURE_MAX_GAPS;
+    for (uint32_t i = 0; i < n; i++) {
+        int32_t x = (((int32_t)frame->gap_at[i] << TRIGGER_FRAC_BITS) - first) / step;
+        if (x < 0 || x >= LCD_W) { continue;}
+        lcd_fillTriangle(x - 3, LCD_H - 1, x + 3, LCD_H - 1, x, LCD_H - 6, GAP_COLOR);
+    }
+}
+
+// trigger mode in the bottom right corner
+static void draw_mode_label(void)
+{
+    static const char *mode_str[] = { "AUTO", "NORM", "SINGLE", "SEGM" };
+    static const char *acq_str[] = { "", "PEAK", "AVG", "HIRES" };
+    lcd_drawString(LCD_W - 40, LCD_H - 10, mode_str[capture_get_mode()], MODE_TXT_COLOR);
+    lcd_drawString(LCD_W - 72, LCD_H - 10, acq_str[acq_mode], MODE_TXT_COLOR);
+}
+
 // to draw the initial grid
 void lcd_draw_grid(void)
 {
@@ -103,7 +229,21 @@ void lcd_draw_grid(void)
        lcd_drawHLine(0, GRID_LINE_HORIZONTAL(i+1), LCD_W, BLACK);
        lcd_drawVLine(GRID_LINE_VERTICAL(i+1), 0, LCD_H, BLACK);
    }
-   lcd_drawString(5, LCD_H-10, timebase_str[current_timebase], TIMEBASE_TXT_COLOR);
+   lcd_drawString(5, LCD_H-10, timebase_str, TIMEBASE_TXT_COLOR);
+   draw_mode_label();
+}
+
+// refresh just the mode label after a button press (no full redraw)
+void waveform_display_draw_mode(void)
+{
+    lcd_fillRect(LCD_W - 72, LCD_H - 10, 72, 10, BACKGROUND_COLOR);
+    draw_mode_label();
+}
+
+// mV as volts with 3 decimals, e.g. -1.234V
+static void format_mv(char *txt, size_t size, int32_t mv)
+{
+    snprintf(txt, size, "%s%ld.%03ldV", (mv < 0) ? "-" : "", (long)(abs(mv) / 1000), (long)(abs(mv) % 1000));
 }
 
 // call this every frame to erase old cursor and draw new one
@@ -139,9 +279,10 @@ void cursor_update(bool frozen, int y_curr)
         
     // fix screen frozen text if needed
     if (frozen && ( (cursor_y < 1 || last_y < 15)  ) ) {
-        lcd_drawString(5, 5, "SCREEN FROZEN", FROZEN_TXT_COLOR);
+        lcd_drawString(5, 5, FROZEN_TXT, FROZEN_TXT_COLOR);
     } else if ( cursor_y > LCD_H - 10 || last_y > LCD_H - 10) {
-        lcd_drawString(5, LCD_H-10, timebase_str[current_timebase], TIMEBASE_TXT_COLOR);   
+        lcd_drawString(5, LCD_H-10, timebase_str, TIMEBASE_TXT_COLOR);   
+        draw_mode_label();
     }
 
     // fix waveform under old cursor
@@ -150,27 +291,36 @@ void cursor_update(bool frozen, int y_curr)
     draw_cursor(new_x, cursor_y, CURSOR_COLOR);
 
     if (frozen) {
-        float voltage = get_voltage_at_cursor(cursor_y);
+        // a peak detect column spans a range: max on top, min under it
+        int32_t mv_lo, mv_hi;
+        get_mv_at_cursor(cursor_y, &mv_lo, &mv_hi);
         char v_txt[32];
-        snprintf(v_txt, sizeof(v_txt), "%.3fV", voltage);
-        lcd_fillRect(LCD_W - 62, 3, 57, 12, BLACK);
+        lcd_fillRect(LCD_W - 62, 3, 57, 22, BLACK);
+        format_mv(v_txt, sizeof(v_txt), mv_hi);
         lcd_drawString(LCD_W-60, 5, v_txt, CURSOR_COLOR);
+        if (mv_lo != mv_hi) {
+            format_mv(v_txt, sizeof(v_txt), mv_lo);
+            lcd_drawString(LCD_W-60, 15, v_txt, CURSOR_COLOR);
+        }
     } else {
-        lcd_fillRect(LCD_W-60,5,55,10,BLACK);
+        lcd_fillRect(LCD_W-60,5,55,20,BLACK);
     }
 
     last_y = cursor_y;
 }
 
-float get_voltage_at_cursor(int cursor_y)
+void get_mv_at_cursor(int cursor_y, int32_t *mv_lo, int32_t *mv_hi)
 {
-    // Find the closest drawn waveform point to the cursor
-    float min_distance = LCD_H;
+    // Find the closest drawn waveform point to the cursor, anywhere on a peak detect span
+    int min_distance = LCD_H;
     int closest_x = -1;
+    *mv_lo = *mv_hi = 0;
     
     for (int x = 0; x < wave_x; x++) {
-        if (drawn_y_values[x] != -1) {
-            float distance = abs(drawn_y_values[x] - cursor_y);
+        if (drawn_y_values[0][x] != -1) {
+            int top = drawn_y_values[0][x], bottom = drawn_y_ends[0][x];
+            if (top > bottom) { top = drawn_y_ends[0][x]; bottom = drawn_y_values[0][x];}
+            int distance = (cursor_y < top) ? top - cursor_y : (cursor_y > bottom) ? cursor_y - bottom : 0;
             if (distance < min_distance) {
                 min_distance = distance;
                 closest_x = x;
@@ -179,143 +329,185 @@ float get_voltage_at_cursor(int cursor_y)
     }
     
     if (closest_x == -1) {
-        return 0.0f; // No valid waveform data
+        return; // No valid waveform data
     }
     
-    // Convert the y pixel position back to ADC value
-    int y = drawn_y_values[closest_x];
-    int adc_value = (y - LCD_MID_HORIZONTAL) * SLOPE_CONVERSION + ADC_MIDPOINT;
-    
-    // Clamp to valid ADC range
-    if (adc_value < 0) adc_value = 0;
-    if (adc_value >= 4096) adc_value = 4095;
-    
-    // Look up real voltage from LUT
-    return ADC_LUT[adc_value];
+    // Look up real voltage from LUT with the sample itself rather than the pixel row,
+    // hi-res bits included
+    int32_t a = adc_lut_mv(drawn_range, drawn_samples[closest_x], drawn_bits);
+    int32_t b = adc_lut_mv(drawn_range, drawn_samples_hi[closest_x], drawn_bits);
+    // the front end inverts, the highest code is the most negative voltage
+    *mv_lo = (a < b) ? a : b;
+    *mv_hi = (a < b) ? b : a;
 }
 
 // ----------------- waveform stuff ----------------------------------
 // -------------------------------------------------------------------
 
-// initialize waveform buffer
+// initialize waveform drawing state
 void waveform_display_init(void)
 {
-   // clear the buffer
-   for (int i=0; i < SAMPLE_BUFFER_SIZE; i++) {
-       sample_buffer[i] = 0;
-   }
    lcd_draw_grid();
    wave_x = 0;
    last_y = -1;
+   interp_init();
+   format_timebase_label();
+   configure_record();
 }
 
-// adds newest sample to buffer
-void waveform_display_add_sample(uint16_t new_sample)
+// draws one whole record, trigger on the pre-trigger column
+static void draw_record(const capture_frame_t *frame)
 {
-   sample_buffer[sample_write_index] = new_sample;
-   sample_write_index = (sample_write_index+1) % SAMPLE_BUFFER_SIZE;   
-}
-
-// draw the waveform LEFT to RIGHT
-void waveform_display_tick(void)
-{
-    float screen_time_window = get_screen_time_window();
-    uint32_t samples_per_screen = (uint32_t)(SAMPLE_RATE_HZ * screen_time_window);    // reset screen and start new waveform drawing
-    
-    if (samples_per_screen >= SAMPLE_BUFFER_SIZE) {
-        samples_per_screen = SAMPLE_BUFFER_SIZE - 1;
-    }
-    int dec = get_decimation_factor();
-    uint32_t start_idx = (sample_write_index + SAMPLE_BUFFER_SIZE - samples_per_screen) % SAMPLE_BUFFER_SIZE;
-
-    if (wave_x >= HW_LCD_W) {
-        wave_x = 0;
-        lcd_draw_grid();
-        draw_cursor(0, last_y, CURSOR_COLOR);
-        for (int i = 0; i < HW_LCD_W; i++) {
-            drawn_y_values[i] = -1; // reset drawn y values
-        }
-    }
-
-    // Pick samples corresponding to pixel
-    uint32_t sample_index = (start_idx + wave_x * dec) % SAMPLE_BUFFER_SIZE;
-    uint16_t adc_raw = sample_buffer[sample_index];
-    int y_curr = ((adc_raw-ADC_MIDPOINT) / SLOPE_CONVERSION) + LCD_MID_HORIZONTAL;
-
-    // save y value abt to be drawn
-    drawn_y_values[wave_x] = y_curr;
-
-    // Only draw if x > 0
-    if (wave_x > 0) {
-        int y_prev = drawn_y_values[wave_x - 1];
-        if (y_prev != -1) {
-            lcd_drawLine(wave_x - 1, y_prev, wave_x, y_curr, WAVEFORM_COLOR);
-        }
-    }
-    wave_x++;
-}
-
-void waveform_display_draw_full_frame(void)
-{
-    float window = get_screen_time_window();
-    uint32_t samples_per_screen = SAMPLE_RATE_HZ * window;
-
-    if (samples_per_screen >= SAMPLE_BUFFER_SIZE) {
-        samples_per_screen = SAMPLE_BUFFER_SIZE - 1;}
-    int dec = samples_per_screen / LCD_W;
-    if (dec < 1) { dec = 1;}
-    
-    uint32_t start_idx =
-        (sample_write_index + SAMPLE_BUFFER_SIZE - samples_per_screen) % SAMPLE_BUFFER_SIZE;
+    int32_t step = get_column_step();
+    const capture_view_t *view = &frame->view;
+    int bits = frame->frac_bits; // hi-res samples: pixels only need the 12 bit code
+    drawn_bits = bits;
+    drawn_range = frame->range;
+
+    // anchor the trace on the interpolated crossing, not the whole trigger sample: it lands
+    // on the pre-trigger column, so the trace stops jumping by a sample from record to record.
+    // positions are in 1/TRIGGER_FRAC_ONE samples
+    int trig_x = LCD_W * TRIGGER_PRETRIGGER_PCT / 100;
+    int32_t crossing = ((int32_t)frame->trigger << TRIGGER_FRAC_BITS) - frame->trigger_frac;
+    int32_t first = crossing - trig_x * step;
+    int32_t last_pos = (int32_t)(view->len - 1) << TRIGGER_FRAC_BITS;
+    if (first < 0) { first = 0;}
+    if (first + (LCD_W - 1) * step > last_pos) { first = last_pos - (LCD_W - 1) * step;}
 
     // Clear & redraw grid
     lcd_draw_grid();
 
-    for (int x = 0; x < LCD_W; x++)
+    // the other channels go down first so the trigger channel ends up on top
+    drawn_channels = frame->channels;
+    for (int c = drawn_channels - 1; c >= 0; c--)
     {
-        uint32_t sample_idx = (start_idx + x * dec) % SAMPLE_BUFFER_SIZE;
-        uint16_t adc_raw = sample_buffer[sample_idx];
-        int y = ((adc_raw - ADC_MIDPOINT) / SLOPE_CONVERSION) + LCD_MID_HORIZONTAL;
-        drawn_y_values[x] = y;
-
-        if (x > 0)
+        const capture_view_t *cv = &frame->ch[c];
+        int *ys = drawn_y_values[c];
+        int *ye = drawn_y_ends[c];
+        // channel c was scanned skew after channel 0: step its positions back by that much so
+        // every trace is drawn at the instant it was sampled
+        int32_t skew = frame->skew[c];
+        for (int x = 0; x < LCD_W; x++)
         {
-            int y_prev = drawn_y_values[x - 1];
-            lcd_drawLine(x - 1, y_prev, x, y, WAVEFORM_COLOR);
+            int32_t pos = first + x * step - skew;
+            if (pos < 0) { pos = 0;}
+            uint32_t idx = pos >> TRIGGER_FRAC_BITS;
+            uint16_t s, hi;
+            if (acq_mode == ACQ_MODE_PEAK) {
+                // every sample of the column's bucket counts, drawn as one vertical span. the
+                // bucket runs up to the next column's first sample so neighbouring spans touch
+                uint32_t next = (pos + step) >> TRIGGER_FRAC_BITS;
+                capture_view_minmax(cv, idx, next - idx + 1, &s, &hi);
+                ys[x] = raw_to_y(s >> bits) + ch_offsets[c];
+                ye[x] = raw_to_y(hi >> bits) + ch_offsets[c];
+                lcd_drawLine(x, ys[x], x, ye[x], ch_colors[c]);
+            } else {
+                s = hi = column_sample(cv, pos, bits);
+                ys[x] = raw_to_y(s >> bits) + ch_offsets[c];
+                ye[x] = ys[x];
+                if (x > 0) { lcd_drawLine(x - 1, ys[x - 1], x, ys[x], ch_colors[c]);}
+            }
+            // the cursor reads the trigger channel
+            if (c == 0) {
+                drawn_samples[x] = s;
+                drawn_samples_hi[x] = hi;
+            }
         }
     }
     wave_x = LCD_W;
+    draw_trigger_marker((crossing - first) / step);
+    draw_gap_markers(frame, first, step);
+}
+
+// takes the newest record and draws it, any_rate also takes records at other rates than the timebase's
+static bool draw_newest(bool any_rate)
+{
+    // take ownership of the newest finished record. acquisition keeps going into the
+    // other frame, so nothing under us changes while drawing. one from before a timebase
+    // change isn't taken, the drawn record stays held for the cursor
+    const capture_frame_t *frame = capture_take_frame_matching(any_rate ? 0 : waveform_display_sample_rate(),
+                                                               get_record_span());
+    if (frame == NULL) { return false;} // no new record, keep the old picture
+
+    draw_record(frame);
     // redraw cursor
     cursor_update(false, last_y);
+    return true;
+}
+
+bool waveform_display_draw_full_frame(void)
+{
+    return draw_newest(false);
+}
+
+bool waveform_display_draw_any_rate(void)
+{
+    return draw_newest(true);
+}
+
+bool waveform_display_draw_segment(uint32_t i)
+{
+    const capture_frame_t *seg = capture_segment(i);
+    const capture_frame_t *seg0 = capture_segment(0);
+    if (seg == NULL || seg->rate_hz != waveform_display_sample_rate() || seg->view.len < get_record_span()) {
+        return false;
+    }
+
+    draw_record(seg);
+    if (last_y >= 0) { draw_cursor(0, last_y, CURSOR_COLOR);}
+
+    // which segment and when it triggered, relative to the first one
+    char txt[32];
+    uint32_t dt_ms = (seg->timestamp - seg0->timestamp) * 1000 / TIMER_RESOLUTION_HZ;
+    snprintf(txt, sizeof(txt), "SEG %lu/%lu +%lums", (unsigned long)(i + 1),
+             (unsigned long)capture_segments_done(), (unsigned long)dt_ms);
+    lcd_drawString(5, 15, txt, FROZEN_TXT_COLOR);
+    return true;
 }
 
 // --------------------- cycle timebase mode ---------------------------
 // ---------------------------------------------------------------------
 
-// used to cycle the timebase mode. intended use with button action
+// used to cycle the timebase mode. intended use with button action. the caller moves the
+// sampler to the new waveform_display_sample_rate()
 void cycle_timebase_mode(void)
 {
     current_timebase = (current_timebase + 1) % NUM_TIMEBASE_MODES;
+    format_timebase_label();
+    configure_record();
     lcd_fillScreen(BACKGROUND_COLOR);
     lcd_draw_grid();
     draw_cursor(0, last_y, CURSOR_COLOR);
-    lcd_drawString(5, LCD_H - 10, timebase_str[current_timebase], TIMEBASE_TXT_COLOR);
+    lcd_drawString(5, LCD_H - 10, timebase_str, TIMEBASE_TXT_COLOR);
     wave_x = 0;
 }
 
+// used to cycle the acquisition (render) mode. intended use with button action
+acq_mode_t cycle_acq_mode(void)
+{
+    acq_mode = (acq_mode + 1) % NUM_ACQ_MODES;
+    // averaging happens in the capture state machine, the other modes are just drawing
+    if (acq_mode == ACQ_MODE_AVERAGE) {
+        capture_set_average(AVERAGE_COUNT, AVERAGE_EXPONENTIAL ? CAPTURE_AVG_EXPONENTIAL : CAPTURE_AVG_BLOCK);
+    } else {
+        capture_set_average(1, CAPTURE_AVG_EXPONENTIAL);
+    }
+    waveform_display_draw_mode();
+    return acq_mode;
+}
+
+// used to switch between linear and sinc upsampling. intended use with button action
+void cycle_interp_mode(void)
+{
+    interp_kind = (interp_kind + 1) % NUM_INTERP_KINDS;
+}
+
 // use to get the rate at which you should redraw the frames
 int get_redraw_interval(void)
 {
-    switch (current_timebase) {
-        case TIMEBASE_8MS:   return 2;  // can't do 1 bc of watchdog problems
-        case TIMEBASE_16MS:  return 2;  // ^^ but 2 gets it to be great anyways
-        case TIMEBASE_32MS:  return 2;  // ^^
-        case TIMEBASE_64MS:  return 2;  // ^^ Redraw every 2 frames (66ms)
-        case TIMEBASE_160MS: return 3;  // Redraw every 5 frames (165ms)
-        case TIMEBASE_320MS: return 10; // Redraw every 10 frames (330ms)
-        case TIMEBASE_640MS: return 20; // every 20 frames...
-        default:             return 2;
-    }
+    // about twice per screen time. never every frame, can't do 1 bc of watchdog problems
+    int frames = get_screen_us() / (2 * 1000 * FRAME_PERIOD_MS);
+    return (frames < 2) ? 2 : frames;
 }
 
 
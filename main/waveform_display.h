@@ -1,27 +1,55 @@
 #pragma once
 
 #include <stdint.h>
-
-// clears and initializes the sample buffer, resets drawing state, and renders initial grid
+#include <stdbool.h>
+
+// how each screen column is made from the samples under it
+typedef enum {
+    ACQ_MODE_SAMPLE,    // one sample per column
+    ACQ_MODE_PEAK,      // min / max of every sample in the column, drawn as a vertical span
+    ACQ_MODE_AVERAGE,   // capture averages AVERAGE_COUNT triggered records, drawn like sample mode
+    ACQ_MODE_HIRES,     // oversampled and boxcar averaged down to the display rate (main sets the stream up)
+    NUM_ACQ_MODES
+} acq_mode_t;
+
+// resets drawing state and renders initial grid. samples come from the capture store
 void waveform_display_init(void);
 
-// adds newest adc_raw sample to circular buffer for real voltage extraction later
-void waveform_display_add_sample(uint16_t sample);
-
-// live waveform renderer for running mode. draws one new column of waveform data each call (no full-screen redraw)
-void waveform_display_tick(void);
-
 //updates horizontal cursor position and draws it with voltage readout. only works when screen is frozen
 void cursor_update(bool frozen, int y_curr);
 
-// full waveform redraw based on current ADC buffer and timebase
-void waveform_display_draw_full_frame(void);
+// full waveform redraw from the newest triggered record. false if there was no new record to draw
+bool waveform_display_draw_full_frame(void);
+
+// same, but whatever rate the record was taken at (drawn on the current timebase's scale).
+// for the rate sweep, which only needs the display load
+bool waveform_display_draw_any_rate(void);
+
+// segmented mode: draws segment i with its number and trigger time. false if it is not captured
+bool waveform_display_draw_segment(uint32_t i);
+
+// redraws the trigger mode label (AUTO / NORM / SINGLE) after the mode changes
+void waveform_display_draw_mode(void);
 
 // rescales waveform horizontally and fully refreshes the display
 void cycle_timebase_mode(void);
 
+// sample rate the current timebase wants (about SAMPLES_PER_COLUMN per screen column)
+uint32_t waveform_display_sample_rate(void);
+
+// steps to the next acquisition mode (sample -> peak detect -> ...), applies from the next redraw.
+// returns the new mode
+acq_mode_t cycle_acq_mode(void);
+
+// the current timebase decimates through the CIC + FIR anti-alias filter rather than a boxcar
+bool waveform_display_anti_alias(void);
+
+// switches the upsampling for fast timebases between linear and sinc, applies from the next redraw
+void cycle_interp_mode(void);
+
 // used to get the frame rate at which to redraw the waveform based on the timebase mode
 int get_redraw_interval(void);
 
-// translates the cursor position to a real voltage level using the ADC_LUT from LUT.c
-float get_voltage_at_cursor(int cursor_y);
+// translates the cursor position to a real voltage level in mV using ADC_LUT_MV from LUT.c.
+// a peak detect column gives its lowest and highest voltage, any other column the same value in both
+void get_mv_at_cursor(int cursor_y, int32_t *mv_lo, int32_t *mv_hi);
@@ -0,0 +1,300 @@
+#!/usr/bin/env python3
+"""Generate components/LUT/LUT.c from adc_logger calibration captures.
+
+Each capture is a /sdcard/data.csv written by adc_logger, taken with a known
+reference voltage on the probe input. A manifest lists them:
+
+    file,volts[,range]
+    cal/m5v0.csv,-5.000
+    cal/p2v5.csv,2.500,3
+
+Paths in the manifest are relative to the manifest. range is the input range
+(adc_atten_t order: 0 = 0 dB ... 3 = 12 dB) the capture was taken at, 12 dB
+when left out. 12 dB must be covered. Every other range with captures gets a
+table of its own, the rest keep borrowing the 12 dB table through their
+nominal attenuation.
+
+Per range, the fit:
+  1. each capture becomes one point: the trimmed mean code (noise averages
+     out below a code) against its reference, weighted by sample count.
+     captures sitting on a rail (code 0 or 4095) are left out
+  2. isotonic regression (pool adjacent violators) makes the points strictly
+     decreasing in code, since the front end inverts. points that disagree
+     with their neighbours get pooled instead of producing a step back
+  3. a monotone cubic (Fritsch-Carlson) goes through the pooled points, linear
+     past the outermost ones, and is sampled at every code in mV
+
+Only the standard library is used and nothing depends on time or ordering on
+disk, so the same captures always give the same LUT.c. Fit statistics go to
+stdout. The LUT component's lut_gen target runs this on LUT_CAL_MANIFEST
+(components/LUT/cal/refs.csv unless set at configure time):
+
+    cmake --build build --target lut_gen
+"""
+
+import argparse
+import csv
+import math
+import os
+import sys
+
+NUM_CODES = 4096
+NUM_RANGES = 4
+RANGE_12DB = 3
+RANGE_NAMES = ["0 dB", "2.5 dB", "6 dB", "12 dB"]
+RANGE_SUFFIX = ["0DB", "2DB5", "6DB", "12DB"]
+# nominal attenuation against 12 dB in Q16, for ranges without captures of their own
+NOMINAL_SCALE = [16468, 21901, 32931, 1 << 16]
+TRIM = 0.05  # share of samples dropped at each end before averaging a capture
+CLIP = 0.01  # captures with more than this share at code 0 or 4095 are past a rail
+PER_LINE = 12
+
+
+class Point:
+    def __init__(self, name, mv, codes):
+        codes = sorted(codes)
+        k = int(len(codes) * TRIM)
+        kept = codes[k:len(codes) - k] if len(codes) > 2 * k else codes
+        self.name = name
+        self.mv = mv
+        self.n = len(codes)
+        self.code = sum(kept) / len(kept)
+        self.sd = math.sqrt(sum((c - self.code) ** 2 for c in kept) / len(kept))
+        # the mean of a clipped capture says little about its reference
+        self.clipped = sum(1 for c in codes if c <= 0 or c >= NUM_CODES - 1) > CLIP * len(codes)
+
+
+def read_capture(path, frac_bits):
+    """adc_raw column of an adc_logger CSV, scaled back to 12 bit codes"""
+    codes = []
+    with open(path, newline="") as f:
+        for row in csv.DictReader(f):
+            codes.append(int(row["adc_raw"]) / (1 << frac_bits))
+    if not codes:
+        sys.exit("%s: no samples" % path)
+    if max(codes) >= NUM_CODES:
+        sys.exit("%s: codes above 4095, hi-res capture? pass --frac-bits" % path)
+    return codes
+
+
+def read_manifest(path, frac_bits):
+    points = [[] for _ in range(NUM_RANGES)]
+    base = os.path.dirname(path)
+    with open(path, newline="") as f:
+        for row in csv.DictReader(f):
+            rng = int(row.get("range") or RANGE_12DB)
+            if not 0 <= rng < NUM_RANGES:
+                sys.exit("%s: range %d out of 0..%d" % (row["file"], rng, NUM_RANGES - 1))
+            mv = float(row["volts"]) * 1000.0
+            codes = read_capture(os.path.join(base, row["file"]), frac_bits)
+            points[rng].append(Point(row["file"], mv, codes))
+    return points
+
+
+def pava_decreasing(xs, ys, ws):
+    """weighted isotonic fit, non-increasing in x. returns the pooled blocks as
+    (mean x, value, weight, members), values strictly decreasing"""
+    blocks = []
+    for x, y, w in zip(xs, ys, ws):
+        blocks.append([x * w, y * w, w, 1])
+        # a block may not sit at or above the one before it
+        while len(blocks) > 1 and blocks[-1][1] / blocks[-1][2] >= blocks[-2][1] / blocks[-2][2]:
+            xw, yw, bw, m = blocks.pop()
+            blocks[-1][0] += xw
+            blocks[-1][1] += yw
+            blocks[-1][2] += bw
+            blocks[-1][3] += m
+    return [(xw / w, yw / w, w, m) for xw, yw, w, m in blocks]
+
+
+def pchip_slopes(xs, ys):
+    """Fritsch-Carlson derivatives: the cubic stays monotone between the knots"""
+    n = len(xs)
+    h = [xs[i + 1] - xs[i] for i in range(n - 1)]
+    d = [(ys[i + 1] - ys[i]) / h[i] for i in range(n - 1)]
+    if n == 2:
+        return [d[0], d[0]]
+    m = [0.0] * n
+    for i in range(1, n - 1):
+        if d[i - 1] * d[i] <= 0:
+            m[i] = 0.0
+        else:
+            w1 = 2 * h[i] + h[i - 1]
+            w2 = h[i] + 2 * h[i - 1]
+            m[i] = (w1 + w2) / (w1 / d[i - 1] + w2 / d[i])
+    # one sided ends from the two outermost secants, kept on the end secant's side
+    # and within 3x of it
+    for i, j, k in ((0, 0, 1), (n - 1, n - 2, n - 3)):
+        e = ((2 * h[j] + h[k]) * d[j] - h[j] * d[k]) / (h[j] + h[k])
+        if e * d[j] <= 0:
+            e = 0.0
+        elif d[j] * d[k] <= 0 and abs(e) > abs(3 * d[j]):
+            e = 3 * d[j]
+        m[i] = e
+    return m
+
+
+def curve(xs, ys, m, x):
+    """monotone cubic through the knots, straight lines on past the ends"""
+    if x <= xs[0]:
+        return ys[0] + (ys[1] - ys[0]) / (xs[1] - xs[0]) * (x - xs[0])
+    if x >= xs[-1]:
+        return ys[-1] + (ys[-1] - ys[-2]) / (xs[-1] - xs[-2]) * (x - xs[-1])
+    lo, hi = 0, len(xs) - 1
+    while hi - lo > 1:
+        mid = (lo + hi) // 2
+        if xs[mid] <= x:
+            lo = mid
+        else:
+            hi = mid
+    h = xs[hi] - xs[lo]
+    t = (x - xs[lo]) / h
+    h00 = (1 + 2 * t) * (1 - t) ** 2
+    h10 = t * (1 - t) ** 2
+    h01 = t * t * (3 - 2 * t)
+    h11 = t * t * (t - 1)
+    return h00 * ys[lo] + h10 * h * m[lo] + h01 * ys[hi] + h11 * h * m[hi]
+
+
+def fit_knots(pts):
+    """pooled knots and their slopes, None with fewer than two knots"""
+    pts = sorted(pts, key=lambda p: (p.code, p.mv))
+    blocks = pava_decreasing([p.code for p in pts], [p.mv for p in pts], [p.n for p in pts])
+    if len(blocks) < 2:
+        return None
+    xs = [b[0] for b in blocks]
+    ys = [b[1] for b in blocks]
+    return xs, ys, pchip_slopes(xs, ys), sum(b[3] - 1 for b in blocks)
+
+
+def fit_range(points):
+    fit = fit_knots([p for p in points if not p.clipped])
+    if fit is None:
+        sys.exit("need at least two unclipped references that read apart")
+    xs, ys, m, pooled = fit
+
+    # into int16 first, leaving every code room for a distinct value on either side of it,
+    # so a curve running past a rail comes out as a run of steps instead of a flat top
+    table = [int(round(curve(xs, ys, m, c))) for c in range(NUM_CODES)]
+    table = [max(-32768 + (NUM_CODES - 1 - c), min(32767 - c, v)) for c, v in enumerate(table)]
+    # strictly decreasing in whole mV. the fit is already, rounding and the clamp can tie
+    # two neighbours
+    nudged = 0
+    for c in range(1, NUM_CODES):
+        if table[c] >= table[c - 1]:
+            table[c] = table[c - 1] - 1
+            nudged += 1
+    return table, (xs, ys, m), pooled, nudged
+
+
+def rms(vals):
+    return math.sqrt(sum(v * v for v in vals) / len(vals))
+
+
+def report(rng, points, table, fit, pooled, nudged, old):
+    xs, ys, m = fit
+    clipped = sum(1 for p in points if p.clipped)
+    print("%s: %d captures, %d clipped, %d pooled as out of order, %d codes nudged apart after rounding"
+          % (RANGE_NAMES[rng], len(points), clipped, pooled, nudged))
+    # the curve goes through every knot, so the residual of a knot only shows pooling.
+    # held out: the error at a reference when the curve is fitted without it, which is
+    # about what codes between references get
+    print("  %-24s %9s %8s %10s %7s %9s %9s %9s %9s"
+          % ("capture", "ref mV", "samples", "mean code", "sd", "noise mV", "fit mV", "resid mV", "held out"))
+    used = [p for p in points if not p.clipped]
+    res, held = [], []
+    for p in sorted(points, key=lambda p: p.mv):
+        if p.clipped:
+            print("  %-24s %9.1f %8d %10.2f %7.2f   clipped, not used" % (p.name, p.mv, p.n, p.code, p.sd))
+            continue
+        f = curve(xs, ys, m, p.code)
+        slope = abs(curve(xs, ys, m, p.code + 0.5) - curve(xs, ys, m, p.code - 0.5))
+        res.append(f - p.mv)
+        out = fit_knots([q for q in used if q is not p])
+        h = "-"
+        if out is not None:
+            held.append(curve(out[0], out[1], out[2], p.code) - p.mv)
+            h = "%.2f" % held[-1]
+        print("  %-24s %9.1f %8d %10.2f %7.2f %9.1f %9.1f %9.2f %9s"
+              % (p.name, p.mv, p.n, p.code, p.sd, p.sd * slope, f, f - p.mv, h))
+    print("  residual: rms %.2f mV, max %.2f mV" % (rms(res), max(abs(r) for r in res)))
+    if held:
+        print("  held out: rms %.2f mV, max %.2f mV" % (rms(held), max(abs(r) for r in held)))
+    if old is not None:
+        diff = [table[c] - old[c] for c in range(NUM_CODES)]
+        back = sum(1 for c in range(1, NUM_CODES) if old[c] >= old[c - 1])
+        print("  against the old table: rms %.1f mV, max %d mV apart. old table steps back or repeats at %d codes"
+              % (rms(diff), max(abs(d) for d in diff), back))
+
+
+def read_old_table(path):
+    """ADC_LUT_MV out of an existing LUT.c"""
+    with open(path) as f:
+        src = f.read()
+    start = src.find("ADC_LUT_MV[")
+    if start < 0:
+        return None
+    body = src[src.index("{", start) + 1:src.index("}", start)]
+    vals = [int(v) for v in body.replace("\n", " ").split(",") if v.strip()]
+    return vals if len(vals) == NUM_CODES else None
+
+
+def format_table(decl, table):
+    lines = ["    " + ", ".join("%5d" % v for v in table[i:i + PER_LINE]) for i in range(0, NUM_CODES, PER_LINE)]
+    return "%s = {\n%s };\n" % (decl, ",\n".join(lines))
+
+
+def emit(path, tables, manifest):
+    out = ['#include "LUT.h"\n',
+           "\n",
+           "// generated by tools/lut_gen.py from %s, regenerate rather than edit\n" % manifest.replace("\\", "/"),
+           "\n",
+           format_table("const int16_t ADC_LUT_MV[4096]", tables[RANGE_12DB])]
+    for rng in range(NUM_RANGES):
+        if rng != RANGE_12DB and tables[rng] is not None:
+            out += ["\n", format_table("static const int16_t ADC_LUT_MV_%s[4096]" % RANGE_SUFFIX[rng], tables[rng])]
+    out += ["\n",
+            "// ranges without captures of their own borrow the 12 dB table through their\n",
+            "// nominal attenuation against it (1, 1.33, 2 and 3.98 x the 0 dB input span)\n",
+            "const adc_range_cal_t ADC_RANGES[ADC_NUM_RANGES] = {\n"]
+    for rng in range(NUM_RANGES):
+        if rng == RANGE_12DB:
+            entry = "{ ADC_LUT_MV, ADC_RANGE_SCALE_ONE },"
+        elif tables[rng] is not None:
+            entry = "{ ADC_LUT_MV_%s, ADC_RANGE_SCALE_ONE }," % RANGE_SUFFIX[rng]
+        else:
+            entry = "{ ADC_LUT_MV, %d }," % NOMINAL_SCALE[rng]
+        measured = ", measured" if tables[rng] is not None else ""
+        out.append("    %-39s // %s%s\n" % (entry, RANGE_NAMES[rng], measured))
+    out.append("};\n")
+    with open(path, "w", newline="\n") as f:
+        f.writelines(out)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    ap.add_argument("manifest", help="CSV of file,volts[,range] rows")
+    ap.add_argument("-o", "--output", help="LUT.c to write (default: statistics only)")
+    ap.add_argument("--frac-bits", type=int, default=0, help="fraction bits of the captured codes (4 for hi-res)")
+    args = ap.parse_args()
+
+    points = read_manifest(args.manifest, args.frac_bits)
+    if not points[RANGE_12DB]:
+        sys.exit("no 12 dB captures, the other ranges fall back on that table")
+    old = read_old_table(args.output) if args.output and os.path.exists(args.output) else None
+
+    tables = [None] * NUM_RANGES
+    for rng in range(NUM_RANGES):
+        if not points[rng]:
+            continue
+        table, fit, pooled, nudged = fit_range(points[rng])
+        tables[rng] = table
+        report(rng, points[rng], table, fit, pooled, nudged, old if rng == RANGE_12DB else None)
+
+    if args.output:
+        emit(args.output, tables, os.path.relpath(args.manifest, os.path.dirname(os.path.abspath(args.output))))
+        print("wrote %s" % args.output)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+"""Host test for tools/lut_gen.py on synthetic captures.
+
+A known, slightly bent transfer curve is sampled into adc_logger style CSVs
+(noise, one capture labelled out of order, one past the rail), run through
+the generator end to end, and the LUT.c it writes is checked: strictly
+decreasing, within tolerance of the true curve away from the mislabelled
+capture, and the bad captures pooled / left out.
+The PCHIP pieces are checked on their own: through every knot, exact on lines,
+monotone with no overshoot. Run by ctest from host_test.
+"""
+
+import math
+import os
+import random
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+sys.path.insert(0, os.path.join(HERE, ".."))
+import lut_gen  # noqa: E402
+
+failures = 0
+
+
+def check(cond, what):
+    global failures
+    if not cond:
+        print("check failed: %s" % what)
+        failures += 1
+
+
+def true_mv(code):
+    """inverting front end, +-5 V over the codes, with a bow the fit has to follow"""
+    x = code / 4095.0
+    return 5000.0 - 10000.0 * x + 120.0 * math.sin(math.pi * x)
+
+
+def true_code(mv):
+    lo, hi = 0.0, 4095.0
+    for _ in range(60):
+        mid = (lo + hi) / 2
+        if true_mv(mid) > mv:
+            lo = mid
+        else:
+            hi = mid
+    return lo
+
+
+def write_capture(path, code, n, rng):
+    with open(path, "w", newline="") as f:
+        f.write("time_s,adc_raw\n")
+        for i in range(n):
+            c = int(round(code + rng.gauss(0, 2.0)))
+            f.write("%f,%d\n" % (i / 5000.0, max(0, min(4095, c))))
+
+
+def end_to_end():
+    rng = random.Random(1)
+    with tempfile.TemporaryDirectory() as d:
+        rows = ["file,volts"]
+        refs = [-4.8 + 0.6 * k for k in range(17)]
+        for k, v in enumerate(refs):
+            name = "ref%02d.csv" % k
+            code = true_code(v * 1000)
+            # one capture labelled past the next reference up, so it reads out of order
+            label = v + 0.7 if k == 8 else v
+            write_capture(os.path.join(d, name), code, 2000, rng)
+            rows.append("%s,%.3f" % (name, label))
+        # a reference past the negative rail: all 4095
+        write_capture(os.path.join(d, "rail.csv"), 4200, 2000, rng)
+        rows.append("rail.csv,-5.500")
+        with open(os.path.join(d, "refs.csv"), "w") as f:
+            f.write("\n".join(rows) + "\n")
+
+        out = os.path.join(d, "LUT.c")
+        r = subprocess.run([sys.executable, os.path.join(HERE, "..", "lut_gen.py"), os.path.join(d, "refs.csv"),
+                            "-o", out], capture_output=True, text=True)
+        check(r.returncode == 0, "lut_gen ran (%s)" % r.stderr.strip())
+        if r.returncode != 0:
+            return
+        check("1 clipped" in r.stdout, "the rail capture is left out")
+        check("1 pooled" in r.stdout, "the mislabelled capture is pooled")
+        table = lut_gen.read_old_table(out)
+        check(table is not None, "LUT.c has a 4096 entry ADC_LUT_MV")
+        if table is None:
+            return
+
+    check(all(table[c] < table[c - 1] for c in range(1, 4096)), "table strictly decreasing")
+    # between the references the curve is smooth, past them it is extrapolated. the pooled
+    # pair is as wrong as its label and bends the slopes up to two references either side
+    lo, hi = true_code(refs[-1] * 1000), true_code(refs[0] * 1000)
+    bad_lo, bad_hi = true_code(refs[11] * 1000), true_code(refs[5] * 1000)
+    inside = [abs(table[c] - true_mv(c)) for c in range(4096) if lo <= c <= hi and not bad_lo < c < bad_hi]
+    worst = max(inside)
+    rms = math.sqrt(sum(e * e for e in inside) / len(inside))
+    print("end to end: between the references rms %.2f mV, max %.2f mV off the true curve" % (rms, worst))
+    check(worst < 2.0, "within 2 mV of the true curve between the references")
+    check(rms < 1.0, "rms under 1 mV between the references")
+
+
+def pchip():
+    # through every knot, straight on straight data
+    xs = [0.0, 100.0, 250.0, 400.0, 1000.0]
+    line = [3000.0 - 2.5 * x for x in xs]
+    m = lut_gen.pchip_slopes(xs, line)
+    for x in (0.0, 37.0, 100.0, 333.3, 999.0, 1200.0, -50.0):
+        check(abs(lut_gen.curve(xs, line, m, x) - (3000.0 - 2.5 * x)) < 1e-9, "line reproduced at %g" % x)
+
+    # decreasing data with a flat stretch and uneven steps: through the knots, never
+    # rising, never past its neighbouring knots
+    ys = [5000.0, 4000.0, 3990.0, 3990.0, -5000.0]
+    m = lut_gen.pchip_slopes(xs, ys)
+    for x, y in zip(xs, ys):
+        check(abs(lut_gen.curve(xs, ys, m, x) - y) < 1e-9, "knot at %g" % x)
+    prev = None
+    over = 0
+    for k in range(0, 1001):
+        x = float(k)
+        v = lut_gen.curve(xs, ys, m, x)
+        if prev is not None and v > prev + 1e-9:
+            over += 1
+        i = max(j for j in range(len(xs) - 1) if xs[j] <= x) if x < xs[-1] else len(xs) - 2
+        if not (min(ys[i], ys[i + 1]) - 1e-9 <= v <= max(ys[i], ys[i + 1]) + 1e-9):
+            over += 1
+        prev = v
+    check(over == 0, "monotone with no overshoot (%d bad points)" % over)
+
+    # against the closed form on a smooth curve: PCHIP is third order accurate inside
+    xs = [k * 256.0 for k in range(17)]
+    ys = [true_mv(x) for x in xs]
+    m = lut_gen.pchip_slopes(xs, ys)
+    err = max(abs(lut_gen.curve(xs, ys, m, c) - true_mv(c)) for c in range(0, 4097, 7))
+    print("pchip: 17 knots on the true curve, max %.3f mV off it" % err)
+    check(err < 0.5, "pchip within 0.5 mV of a smooth curve")
+
+
+def rails():
+    # a curve running well past int16 at both ends still comes out strictly decreasing,
+    # clamped into range rather than flattened at the rails
+    pts = []
+    for code, mv in ((200, 30000.0), (2000, 0.0), (3900, -30000.0)):
+        p = lut_gen.Point("r%d" % code, mv, [code] * 10)
+        pts.append(p)
+    table = lut_gen.fit_range(pts)[0]
+    check(all(-32768 <= v <= 32767 for v in table), "table within int16")
+    check(all(table[c] < table[c - 1] for c in range(1, 4096)), "strictly decreasing at the rails")
+    check(table[0] == 32767 and table[4095] == -32768, "rails reached")
+
+
+def main():
+    end_to_end()
+    pchip()
+    rails()
+    if failures:
+        print("%d check(s) failed" % failures)
+        return 1
+    print("ok")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())